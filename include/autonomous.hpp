@@ -7,4 +7,19 @@ void autoSkill();             // full 2min. skill autonomous
 
 void autoTask();              // sample autonomous using tasks
 
+void autoCharacterize();      // measure the drivebase constants
+
+void autoPursuit();           // sample autonomous following a curved path
+
+void autoTrajectory();        // sample autonomous driving a precompiled trajectory
+
+void prepareTrajectories();   // make (or load from SD) the trajectories generated on
+                              // the brain - call in initialize()
+
+void autoCachedTrajectory();  // sample autonomous driving a trajectory from the SD cache
+
+void autoPlanned();           // sample autonomous driving a route found by the planner
+
+void autoReplay();            // drive a route recorded in opcontrol() (recorder.cpp)
+
 #endif
@@ -0,0 +1,129 @@
+#ifndef AUTOSCRIPT_H_
+#define AUTOSCRIPT_H_
+
+#include <cstdint>
+#include "intake.hpp"                 // intakeEvent_e, no PROS in there either
+
+// Autonomous scripts: a routine compiled to a few bytes of "bytecode" by the host tool
+// tools/autoc.cpp, copied to the SD card and run by the interpreter in autoscript.cpp.
+// A routine can then be changed at an event without building and uploading the program.
+// This header does not use PROS so host side tools can include it as well.
+//
+// File layout: scriptHeader, then the code.  Every instruction is one opcode byte
+// followed by its operands, numbers are little endian:
+//
+//   SCRIPT_DRIVE    int16 distance mm, uint8 speed RPM       driveForDistance()
+//   SCRIPT_TURN     int16 angle 0.1 degree, uint8 speed RPM  pivotTurn()
+//   SCRIPT_INTAKE   uint8 intake event                       intakePost()
+//   SCRIPT_WAIT     uint16 ms
+//   SCRIPT_TRIGGER  uint8 kind, int16 value, uint8 event     trigger for the next motion,
+//                                                            value mm or 0.1 degree
+//   SCRIPT_BRANCH   uint8 condition, uint16 target           jump to the code offset
+//                                                            target if condition is true
+//   SCRIPT_SWING    int16 left mm, int16 right mm,           DriveMove with a distance
+//                   uint8 speed RPM                          for each side
+//   SCRIPT_END
+
+#define SCRIPT_MAGIC 0x4F545541       // "AUTO"
+#define SCRIPT_VERSION 1
+#define SCRIPT_MAX_BYTES 4096         // code size the interpreter can hold
+
+struct scriptHeader {
+  std::uint32_t magic;                // SCRIPT_MAGIC
+  std::uint16_t version;              // SCRIPT_VERSION
+  std::uint16_t length;               // bytes of code following the header
+};
+
+enum scriptOp_e {
+  SCRIPT_END = 0,
+  SCRIPT_DRIVE,
+  SCRIPT_TURN,
+  SCRIPT_INTAKE,
+  SCRIPT_WAIT,
+  SCRIPT_TRIGGER,
+  SCRIPT_BRANCH,
+  SCRIPT_SWING,
+  SCRIPT_OP_COUNT
+};
+
+enum scriptTrigger_e {
+  SCRIPT_TRIGGER_DISTANCE = 0,
+  SCRIPT_TRIGGER_HEADING
+};
+
+enum scriptCondition_e {
+  SCRIPT_ALWAYS = 0,
+  SCRIPT_INTAKE_FULL,                 // intake holds INTAKE_CAPACITY objects
+  SCRIPT_INTAKE_EMPTY,                // no objects of our color taken in
+  SCRIPT_INTAKE_JAMMED,               // intake gave up clearing a jam
+  SCRIPT_ALLIANCE_RED,
+  SCRIPT_ALLIANCE_BLUE,
+  SCRIPT_CONDITION_COUNT
+};
+
+// bytes of an instruction including the opcode, 0 for an unknown opcode
+inline int scriptOpSize(std::uint8_t op) {
+  static const std::uint8_t sizes[SCRIPT_OP_COUNT] = {1, 4, 4, 2, 3, 5, 4, 6};
+  return (op < SCRIPT_OP_COUNT) ? sizes[op] : 0;
+}
+
+inline std::int16_t scriptInt16(const std::uint8_t* p) {
+  return (std::int16_t)(p[0] | (p[1] << 8));
+}
+
+inline std::uint16_t scriptUint16(const std::uint8_t* p) {
+  return (std::uint16_t)(p[0] | (p[1] << 8));
+}
+
+// Check a whole script before running it: known opcodes, no instruction cut off at the
+// end, every branch lands on the start of an instruction and every trigger kind, branch
+// condition and intake event is known.  Returns true if it is ok.
+inline bool scriptValidate(const std::uint8_t* code, int length) {
+  static bool start[SCRIPT_MAX_BYTES + 1];
+  if(length < 1 || length > SCRIPT_MAX_BYTES) {
+    return false;
+  }
+  for(int i = 0; i <= length; i++) {
+    start[i] = false;
+  }
+  for(int pc = 0; pc < length; pc += scriptOpSize(code[pc])) {
+    int size = scriptOpSize(code[pc]);
+    if(size == 0 || pc + size > length) {
+      return false;
+    }
+    start[pc] = true;
+  }
+  for(int pc = 0; pc < length; pc += scriptOpSize(code[pc])) {
+    if(code[pc] == SCRIPT_BRANCH) {
+      int target = scriptUint16(&code[pc + 2]);
+      if(code[pc + 1] >= SCRIPT_CONDITION_COUNT || target >= length || !start[target]) {
+        return false;
+      }
+    }
+    if(code[pc] == SCRIPT_TRIGGER &&
+       (code[pc + 1] > SCRIPT_TRIGGER_HEADING || code[pc + 4] >= INTAKE_EV_COUNT)) {
+      return false;
+    }
+    if(code[pc] == SCRIPT_INTAKE && code[pc + 1] >= INTAKE_EV_COUNT) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ------------------- interpreter on the brain (autoscript.cpp) ---------------------
+// Every routine which can come from the card has its own slot, so loading one script
+// never replaces another.
+
+enum scriptSlot_e {
+  SCRIPT_SLOT_AUTO45 = 0,             // auto45sec.bin, for auto45sec()
+  SCRIPT_SLOT_SKILL,                  // autoSkill.bin, for autoSkill()
+  SCRIPT_SLOTS
+};
+
+bool scriptLoad(scriptSlot_e slot, const char* name);   // read /usd/<name>.bin into slot,
+                                                        // false if missing or bad
+bool scriptLoaded(scriptSlot_e slot); // true if a script was loaded into slot
+void scriptRun(scriptSlot_e slot);    // run the script in slot - blocking
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef BATTERY_H_
+#define BATTERY_H_
+
+#include <cstdint>
+
+#define BATTERY_LOOP_MS 10            // battery sample period in ms
+#define BATTERY_NOMINAL_MV 12500      // battery voltage all drive voltages are meant for
+#define BATTERY_FILTER 0.1            // smoothing of the voltage and current readings
+#define BATTERY_MIN_SCALE 0.9         // limits of the compensation, a reading far off
+#define BATTERY_MAX_SCALE 1.3         // must not make the robot jump
+#define BATTERY_LOG_MS 100            // sag log, one voltage / current pair every 100ms
+#define BATTERY_LOG_SIZE 1500         // the last 2.5 minutes enabled - a whole match
+#define BATTERY_LOG_FILE "/usd/battery.csv"
+
+// Battery voltage compensation.  A motor voltage (move_voltage) is really a part of the
+// battery voltage: 6000mV is half of whatever the battery gives.  A full battery gives
+// more than a used one, and every battery sags while the motors pull current, so the
+// same command drives the wheels at a different speed - and an autonomous drives a
+// different distance.  All drive voltages go through driveSetVoltage() (drivebase.cpp),
+// which scales them by BATTERY_NOMINAL_MV / battery voltage: the motors then get what
+// the feedforward (feedforward.hpp) expects, from a full to a sagging battery.
+//
+// While the robot is enabled the battery task also logs the voltage against the current
+// pulled, and fits the straight line   voltage = openVoltage - resistance * current
+// through the log.  Standing disabled on the field is not logged, it would only add
+// idle samples and push the match out of the log.
+
+extern float batteryVoltage;          // mV, filtered
+extern float batteryCurrent;          // mA, filtered
+extern float batteryOpenVoltage;      // mV, fitted voltage without load
+extern float batteryResistance;       // mOhm, fitted internal resistance (sag per A)
+
+float batteryScale();                 // multiply drive voltages with this
+
+bool batterySaveLog();                // write the sag log to BATTERY_LOG_FILE as csv,
+                                      // false if there is nothing logged yet
+
+extern void batteryTaskFnc(void* ignore);   // battery monitor, started in initialize()
+
+#endif
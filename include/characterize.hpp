@@ -0,0 +1,26 @@
+#ifndef CHARACTERIZE_H_
+#define CHARACTERIZE_H_
+
+#include "feedforward.hpp"
+
+#define CHAR_RAMP_RATE 500        // quasistatic test: mV added every second
+#define CHAR_RAMP_MAX 6000        // quasistatic test: stop ramping at this voltage
+#define CHAR_STEP_VOLTAGE 6000    // dynamic test: voltage step in mV
+#define CHAR_STEP_TIME 1500       // dynamic test: length in ms
+#define CHAR_SPIN_VOLTAGE 4000    // track width test: voltage for turning in place
+#define CHAR_SPIN_TIME 3000       // track width test: length in ms
+#define CHAR_MAX_DISTANCE 150     // cm - any straight test stops after this distance
+#define CHAR_MIN_VELOCITY 1.0     // cm/s - slower samples are not used in the fit
+#define CHAR_PAUSE 1000           // ms to wait between tests so the robot stops
+
+struct charResult {
+  ffGains left;                   // fitted feedforward constants
+  ffGains right;
+  float trackWidth;               // effective WHEEL_BASE in cm
+  float wheelDiam;                // effective WHEEL_DIAM in cm
+  bool valid;                     // false if the fit did not work out
+};
+
+charResult characterizeDrive();   // run all tests, fit and apply the constants
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef COLORSORT_H_
+#define COLORSORT_H_
+
+#define OPTICAL_SAMPLE_MS 5           // the sensor sends new data about every 10ms, we
+                                      // poll twice as often to see it as early as possible
+#define OPTICAL_LED_PWM 100           // % LED brightness - constant light, constant colors
+#define OPTICAL_PROX_ENTER 150        // proximity (0-255) above this - object in front
+#define OPTICAL_PROX_EXIT 100         // proximity below this - object gone
+#define OPTICAL_DEBOUNCE 2            // samples in a row before we believe a change
+
+// hue ranges in degrees (0-360), red wraps around 0
+#define HUE_RED_LOW 330
+#define HUE_RED_HIGH 30
+#define HUE_BLUE_LOW 180
+#define HUE_BLUE_HIGH 260
+
+enum objectColor_e {
+  OBJECT_UNKNOWN,
+  OBJECT_RED,
+  OBJECT_BLUE
+};
+
+extern objectColor_e allianceColor;   // color we keep, the other color is ejected -
+                                      // OBJECT_UNKNOWN keeps everything
+extern int objectsSeen;               // objects which passed the sensor
+extern objectColor_e lastObjectColor; // color of the last object
+
+objectColor_e hueToColor(double hue); // red, blue or unknown
+
+extern void colorSortTaskFnc(void* ignore);   // optical sensor task, posts object
+                                              // events to the intake task
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include "intake.hpp"
+#include "purepursuit.hpp"
+#include "trajectory.hpp"
+
+#define CMD_LOOP_MS 10                // scheduler tick, the same as DRIVE_LOOP_MS
+#define CMD_POOL_BYTES 16384          // memory for all commands of a routine
+#define CMD_GROUP_MAX 12              // commands in one group
+#define CMD_MAX_SCHEDULED 8           // commands the scheduler runs at the same time
+
+// subsystems a command needs for itself - the scheduler never lets two running
+// commands use the same subsystem
+#define REQ_NONE 0
+#define REQ_DRIVE 1
+#define REQ_INTAKE 2
+
+// A command is one thing the robot does, for example driving 100cm.  It is not blocking,
+// the scheduler calls execute() every CMD_LOOP_MS until isFinished() returns true - so
+// many commands can run at the same time in a single task.  Groups combine commands into
+// a tree, a whole autonomous routine is then a single command:
+//
+//    commandRun(cmdSequence({
+//      cmdDeadline({ cmdDrive(150, 50), cmdIntakeRun() }),   // intake while driving
+//      cmdTurn(90, 25),
+//      cmdDrive(-100, 50)
+//    }));
+//
+// All commands are made in a fixed memory pool, not on the heap.  Build the whole tree
+// at the start of the routine, commandPoolReset() frees them all at once.
+
+class Command {
+  public:
+    virtual ~Command() {}
+    virtual void initialize() {}            // called once when the command starts
+    virtual void execute() {}               // called every tick while running
+    virtual bool isFinished() { return true; }
+    virtual void end(bool interrupted) {}   // called once at the end, interrupted =
+                                            // stopped before it was finished
+    std::uint32_t requirements = REQ_NONE;  // REQ_ bits of the subsystems it uses
+};
+
+// ------------------- pool allocation ---------------------------------------------
+void* commandAlloc(std::size_t size);   // memory from the pool, nullptr when full
+void commandPoolReset();                // free all commands - only when none runs
+int commandPoolUsed();                  // bytes in use
+
+// make any command in the pool, also your own Command classes
+template <typename T, typename... Args> T* cmdNew(Args... args) {
+  void* memory = commandAlloc(sizeof(T));
+  return (memory == nullptr) ? nullptr : new(memory) T(args...);
+}
+
+// ------------------- groups ----------------------------------------------------------
+Command* cmdSequence(std::initializer_list<Command*> commands);   // one after the other
+Command* cmdParallel(std::initializer_list<Command*> commands);   // all at once, until
+                                                                  // all are finished
+Command* cmdRace(std::initializer_list<Command*> commands);       // all at once, until
+                                                                  // any one finishes
+Command* cmdDeadline(std::initializer_list<Command*> commands);   // all at once, until the
+                                                                  // first in the list
+                                                                  // finishes, the others
+                                                                  // are interrupted
+
+// ------------------- commands ----------------------------------------------------------
+Command* cmdDrive(float distance, int speed);                 // driveForDistance()
+Command* cmdDriveSides(float leftDistance, float rightDistance, int speed);   // cm, RPM
+Command* cmdTurn(float angle, int speed);                     // pivotTurn()
+Command* cmdPath(const ppPath &path, int speed, bool reverse = false);   // followPath()
+Command* cmdTrajectory(const trajPoint* trajectory, int count);   // followTrajectory()
+Command* cmdIntake(intakeEvent_e event);      // post an event to the intake task
+Command* cmdIntakeRun();                      // intake on until this command ends
+Command* cmdWait(std::uint32_t ms);
+Command* cmdWaitUntil(bool (*condition)());   // until condition() returns true
+Command* cmdRun(void (*callback)(void* arg), void* arg = nullptr);   // call once
+Command* cmdPrint(const char* text);          // print to the terminal
+
+// ------------------- scheduler -------------------------------------------------------
+void commandSchedule(Command* command);       // start a command - running commands
+                                              // which need the same subsystem are interrupted
+void commandCancel(Command* command);         // interrupt a running command
+void commandCancelAll();
+bool commandIsScheduled(Command* command);
+void commandTick();                           // one tick of all running commands
+
+void commandRun(Command* command);            // schedule and tick until everything is
+                                              // finished - blocking
+
+#endif
@@ -2,10 +2,40 @@
 #define DRIVE_BASE_H_
 
 #include "globals.hpp"
+#include "pid.hpp"
+#include "profile.hpp"
+#include "drivemodel.hpp"         // WHEEL_DIAM, WHEEL_BASE and the move limits
 
-#define WHEEL_DIAM 7      // diameter in cm
-#define WHEEL_BASE 38.5   // wheel base distance between center
-                          // of two frontwheels in cm
+#define DRIVE_TOLERANCE 5         // encoder degrees we need to be within of target
+#define DRIVE_INTEGRAL_LIMIT 2000 // maximum mV the integral term may add
+#define DRIVE_SLEW_LIMIT 1200     // maximum change in mV per loop
+
+// A DriveMove moves both sides of the drivebase along a motion profile, one control
+// loop at a time: call start() once, then step() every DRIVE_LOOP_MS until it returns
+// true.  Every loop the profile gives the wanted velocity and acceleration which the
+// feedforward (feedforward.hpp) turns into a voltage, a PID corrects the position error.
+class DriveMove {
+  public:
+    DriveMove();
+    void start(float leftDistance, float rightDistance, int speed);   // cm, RPM
+    bool step();                  // one control loop, returns true when finished
+    bool isDone();
+    float getTravelled();         // cm travelled along the profile so far
+    void stop();                  // stop the motors and end the move
+
+  private:
+    motionProfile profile;
+    float leftScale;              // side distance / profile distance
+    float rightScale;
+    float leftTarget;             // final target in encoder degrees
+    float rightTarget;
+    float profileTime;            // seconds along the profile
+    PID<float> leftPID;
+    PID<float> rightPID;
+    int settled;
+    std::uint32_t timeout;
+    bool done;
+};
 
 void driveForDistance(float distance, int speed);  // drive a distance in cm at
                                                    // a given speed
@@ -15,6 +45,11 @@ void pivotTurn(float angle, int speed);            // pivot turn (turn in place)
                                                    // given speed. -deg counter
                                                    // clockwise turn.
 
+void driveSetVoltage(float leftVoltage, float rightVoltage);   // mV at nominal battery,
+                                                   // compensated and limited
+
+void runDriveMove(DriveMove &move);                 // run a started move until done
+
 extern void driveTaskFnc(void* ignore);  // control divebase via task
 
 #endif
@@ -0,0 +1,35 @@
+#ifndef DRIVE_MODEL_H_
+#define DRIVE_MODEL_H_
+
+// The size of the drivebase and the limits its moves are planned with, and a model of
+// how long a move takes.  DriveMove (drivebase.cpp) plans its moves with the same
+// functions, so the times predicted here are what the robot does - as long as the
+// wheels do not slip.  This header does not use PROS so host tools can use it too.
+
+#define WHEEL_DIAM 7      // diameter in cm
+#define WHEEL_BASE 38.5   // wheel base distance between center
+                          // of two frontwheels in cm
+#define DRIVE_FREE_RPM 100        // drive motor speed at 12V (red cartridge)
+
+#define DRIVE_LOOP_MS 10          // drivebase control loop period in ms
+#define DRIVE_SETTLE_TICKS 3      // number of loops within tolerance to be done
+#define DRIVE_MAX_ACCEL 60        // profile acceleration in cm/s^2
+
+struct moveTime {
+  float expected;       // seconds: profile + settling, what a normal move takes
+  float timeout;        // seconds: when DriveMove gives up on the move
+};
+
+float driveMaxVelocity(int speed);        // cm/s for a speed in RPM, never more than
+                                          // the motors reach (see feedforward.hpp)
+
+float pivotDistance(float angle);         // cm each wheel travels for a pivot turn of
+                                          // angle degrees
+
+moveTime timeDriveSides(float leftDistance, float rightDistance, int speed);  // cm, RPM
+
+moveTime timeDrive(float distance, int speed);      // driveForDistance()
+
+moveTime timeTurn(float angle, int speed);          // pivotTurn()
+
+#endif
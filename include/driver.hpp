@@ -0,0 +1,31 @@
+#ifndef DRIVER_H_
+#define DRIVER_H_
+
+#include <cstdint>
+
+#define DRIVER_LOOP_MS 10             // driver control loop period in ms
+#define DRIVER_PRIORITY (TASK_PRIORITY_MAX - 2)   // opcontrol runs at this priority
+#define DRIVER_DEADBAND 5             // stick values (of 127) which do nothing
+#define DRIVER_DRIVE_EXPO 2.5         // curve of the forward stick, 0 = straight line
+#define DRIVER_TURN_EXPO 3.5          // curve of the turn stick, softer around center
+#define DRIVER_TURN_GAIN 0.7          // full turn stick gives 70% of the voltage
+#define DRIVER_SLEW_UP 1500           // mV per loop the voltage may rise (0 to 12V in 80ms)
+#define DRIVER_SLEW_DOWN 3000         // mV per loop it may drop, braking is faster
+#define DRIVER_STEP_RPM 5             // the response measurement ends when a wheel turns
+                                      // this fast
+
+// Arcade driver control: the left stick drives forward and backward, the right stick
+// turns.  Every DRIVER_LOOP_MS the driver loop reads both sticks once, looks the voltage
+// up in a table (deadband and curve in one) and limits how fast it may change (slew),
+// then writes both wheels straight away.
+//
+// The loop also measures its latency: the loop time from reading the sticks to writing
+// the motors, and the response time from moving a stick until a wheel really turns.
+
+extern std::uint32_t driverLoopMaxUs;     // longest stick read to motor write, in us
+extern std::uint32_t driverResponseMs;    // last stick move to wheel turning, in ms
+
+void driverControl();                     // driver control loop, call at the end of
+                                          // opcontrol() - it never returns
+
+#endif
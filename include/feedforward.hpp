@@ -0,0 +1,38 @@
+#ifndef FEEDFORWARD_H_
+#define FEEDFORWARD_H_
+
+// Feedforward turns a wanted wheel velocity and acceleration straight into a motor
+// voltage, using constants found by characterizing the drivebase:
+//
+//    voltage = kS * sign(velocity) + kV * velocity + kA * acceleration
+//
+//    kS - voltage needed to just get the wheel moving (friction)
+//    kV - voltage per cm/s of wheel speed
+//    kA - voltage per cm/s^2 of wheel acceleration
+//
+// This header does not use PROS so host side tools can include it as well.
+
+// nominal values - 100RPM at 12V on a 7cm wheel is about 36.6 cm/s
+#define FF_LEFT_KS 600.0      // mV
+#define FF_LEFT_KV 312.0      // mV per cm/s
+#define FF_LEFT_KA 25.0       // mV per cm/s^2
+#define FF_RIGHT_KS 600.0
+#define FF_RIGHT_KV 312.0
+#define FF_RIGHT_KA 25.0
+
+#define FF_MAX_VOLTAGE 12000  // motor voltage limit in mV
+
+struct ffGains {
+  float kS;
+  float kV;
+  float kA;
+};
+
+extern ffGains leftFF;          // left side drive constants
+extern ffGains rightFF;         // right side drive constants
+
+float ffVoltage(const ffGains &gains, float velocity, float acceleration);  // in mV
+
+float ffMaxVelocity(const ffGains &gains);    // fastest cm/s reachable at FF_MAX_VOLTAGE
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef FIXED_H_
+#define FIXED_H_
+
+#include <cstdint>
+
+// Fixed is a Q16.16 fixed point number: 16 bits whole number, 16 bits fraction.
+// It can be used in place of float in the PID<T> template (see pid.hpp), it stores
+// values between -32768 and 32767 with a resolution of about 0.000015.
+//
+// The arithmetic saturates: a result outside that range sticks at the largest or
+// smallest value instead of wrapping around to the other sign.  A PID output of
+// 12000mV needs kP * error to fit, a wrapped product would turn full forward into full
+// reverse - saturated it is only limited, and the PID output limit takes over from there.
+
+class Fixed {
+  public:
+    constexpr Fixed() : raw(0) {}
+    constexpr Fixed(int value) : raw(saturate((std::int64_t)value * ONE)) {}
+    constexpr Fixed(float value) : raw(saturate(value * (double)ONE)) {}
+    constexpr Fixed(double value) : raw(saturate(value * ONE)) {}
+
+    static constexpr Fixed fromRaw(std::int32_t value) { Fixed f; f.raw = value; return f; }
+
+    constexpr float toFloat() const { return (float)raw / ONE; }
+    constexpr int toInt() const { return raw / ONE; }
+    constexpr std::int32_t getRaw() const { return raw; }
+
+    constexpr Fixed operator-() const { return fromRaw(saturate(-(std::int64_t)raw)); }
+    constexpr Fixed operator+(Fixed b) const { return fromRaw(saturate((std::int64_t)raw + b.raw)); }
+    constexpr Fixed operator-(Fixed b) const { return fromRaw(saturate((std::int64_t)raw - b.raw)); }
+    constexpr Fixed operator*(Fixed b) const {
+      return fromRaw(saturate(((std::int64_t)raw * b.raw) >> 16));
+    }
+    constexpr Fixed operator/(Fixed b) const {
+      if(b.raw == 0) {                // divide by zero gives the largest value of the sign
+        return fromRaw(raw < 0 ? RAW_MIN : RAW_MAX);
+      }
+      return fromRaw(saturate(((std::int64_t)raw * ONE) / b.raw));
+    }
+
+    Fixed &operator+=(Fixed b) { return *this = *this + b; }
+    Fixed &operator-=(Fixed b) { return *this = *this - b; }
+    Fixed &operator*=(Fixed b) { return *this = *this * b; }
+    Fixed &operator/=(Fixed b) { return *this = *this / b; }
+
+    constexpr bool operator<(Fixed b) const { return raw < b.raw; }
+    constexpr bool operator>(Fixed b) const { return raw > b.raw; }
+    constexpr bool operator<=(Fixed b) const { return raw <= b.raw; }
+    constexpr bool operator>=(Fixed b) const { return raw >= b.raw; }
+    constexpr bool operator==(Fixed b) const { return raw == b.raw; }
+    constexpr bool operator!=(Fixed b) const { return raw != b.raw; }
+
+  private:
+    static constexpr std::int32_t ONE = 1 << 16;
+    static constexpr std::int32_t RAW_MAX = 0x7fffffff;
+    static constexpr std::int32_t RAW_MIN = -RAW_MAX - 1;
+
+    static constexpr std::int32_t saturate(std::int64_t value) {
+      return value > RAW_MAX ? RAW_MAX : value < RAW_MIN ? RAW_MIN : (std::int32_t)value;
+    }
+    static constexpr std::int32_t saturate(double value) {
+      return value >= RAW_MAX ? RAW_MAX : value <= RAW_MIN ? RAW_MIN : (std::int32_t)value;
+    }
+    std::int32_t raw;
+};
+
+#endif
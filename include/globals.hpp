@@ -15,11 +15,15 @@ extern pros::Motor left_wheel;
 extern pros::Motor right_wheel;
 
 extern pros::Motor intake_motor;            // intake motor
+extern pros::Optical intake_optical;        // optical sensor in the intake
 
 // ----------- make sure the odometers are available to all code -----------
 extern pros::Rotation left_odom;      // left side odometer
 extern pros::Rotation right_odom;     // right side odometer
 
+// ----------- the driver's controller -------------------------------------
+extern pros::Controller master;
+
 // ----------- declare soem global variables ------------------------------
 extern int motorMaxSpeed;             // Maximum movement speed
 extern const int motorDefaultSpeed;   // default movement speed we like
@@ -1,10 +1,65 @@
 #ifndef INTAKE_H_
 #define INTAKE_H_
 
+#define INTAKE_LOOP_MS 10             // jam check period in ms while running
+#define INTAKE_SPEED 75               // RPM clockwise - inwards
+#define INTAKE_OUTTAKE_SPEED -50      // RPM counter clockwise - outwards
+#define INTAKE_QUEUE_SIZE 16          // events waiting for the intake task
+
+enum intakeState_e {
+  INTAKE_IDLE,                        // motor off
+  INTAKE_INTAKING,                    // running inwards
+  INTAKE_OUTTAKING,                   // running outwards
+  INTAKE_UNJAMMING,                   // short reverse pulse to clear a jam
+  INTAKE_HOLDING,                     // motor stopped, holding its position
+  INTAKE_EJECTING                     // short outwards pulse to throw out an object
+};
+
+enum intakeEvent_e {
+  INTAKE_EV_STOP,                     // go to IDLE
+  INTAKE_EV_INTAKE,                   // go to INTAKING
+  INTAKE_EV_OUTTAKE,                  // go to OUTTAKING
+  INTAKE_EV_HOLD,                     // go to HOLDING
+  INTAKE_EV_OBJECT_OURS,              // optical sensor saw an object of our color
+  INTAKE_EV_OBJECT_WRONG,             // optical sensor saw an object of the other color
+  INTAKE_EV_COUNT                     // number of events, not an event
+};
+
+// jam detection - a jam is a commanded intake which barely turns while pulling hard
+#define INTAKE_JAM_VEL_RATIO 0.25     // turning slower than 25% of commanded speed
+#define INTAKE_JAM_CURRENT 2000       // mA - and drawing more than this current
+#define INTAKE_JAM_TORQUE 0.8         // Nm - or pushing more than this torque
+#define INTAKE_JAM_SAMPLES 4          // samples in a row (40ms) before we call it a jam
+#define INTAKE_SPINUP_MS 150          // no jam checks this long after a new command,
+                                      // a motor speeding up also draws a lot of current
+#define INTAKE_UNJAM_SPEED -100       // RPM of the reverse pulse
+#define INTAKE_UNJAM_MS 150           // length of the reverse pulse
+#define INTAKE_EJECT_SPEED -200       // RPM outwards to throw out a wrong color object
+#define INTAKE_EJECT_MS 250           // length of the eject pulse
+#define INTAKE_CAPACITY 2             // objects the intake can hold
+#define INTAKE_MAX_UNJAMS 3           // give up after this many jams in a row ...
+#define INTAKE_JAM_WINDOW_MS 2000     // ... within this time, the motor would overheat
+
+extern int intakeObjectCount;         // objects of our color taken in
+extern int intakeJamCount;            // number of jams cleared since program start
+extern bool intakeJammed;             // true when we gave up, the intake is stopped
+                                      // until it is asked to run again
+
 void runIntake(int speed);          // control the intake:
                                     // speed = 0 - stopped
                                     // speed +- value run at given speed
 
-extern void intakeTaskFnc(void* ignore);  // control intake via task
+void intakeJamReset();              // start jam detection again, call on a new command
+
+bool intakeJamCheck(int speed);     // call every INTAKE_LOOP_MS with the commanded RPM,
+                                    // returns true when the intake is jammed
+
+bool intakePost(intakeEvent_e event);   // send an event to the intake task, safe from
+                                        // any task - false if the queue was full
+
+intakeState_e intakeGetState();     // current state of the intake
+
+extern void intakeTaskFnc(void* ignore);  // intake state machine task, clears jams
+                                          // by itself with a short reverse pulse
 
 #endif
@@ -0,0 +1,47 @@
+#ifndef MOTOR_HEALTH_H_
+#define MOTOR_HEALTH_H_
+
+#include <cstdint>
+
+#define HEALTH_LOOP_MS 100            // monitor period, temperature changes slowly
+#define HEALTH_DERATE_TEMP 55.0       // C - the motor firmware halves its current from here
+#define HEALTH_TAU 150.0              // s - thermal time constant of a V5 motor
+#define HEALTH_K 10.0                 // C per A^2 - heating above ambient at steady current
+#define HEALTH_TEMP_BLEND 0.1         // how fast the model follows the temperature sensor
+#define HEALTH_CURRENT_FILTER 0.05    // current average, about 2 sec at 100ms
+#define HEALTH_WARN_TIME 30.0         // s - start lowering the cap this long before derating
+#define HEALTH_MIN_CAP 0.6            // lowest cap, reached at the derating temperature
+#define HEALTH_CAP_STEP 0.02          // most the cap may change per loop, so it is smooth
+
+// A background monitor of the motors in globals.cpp.  The motor firmware protects a hot
+// motor by cutting its current (and so its torque) in steps from HEALTH_DERATE_TEMP, which
+// the robot notices as suddenly getting weak.  The monitor predicts with a thermal model
+// when each motor gets there, and slowly lowers a speed cap well before - the robot gets
+// a bit slower, but stays predictable to the end of a skills run.
+
+enum healthMotor_e {
+  HEALTH_LEFT = 0,
+  HEALTH_RIGHT,
+  HEALTH_INTAKE,
+  HEALTH_MOTORS
+};
+
+struct motorHealth {
+  float temperature;          // C, thermal model - between the 5 degree sensor steps
+  float steadyTemperature;    // C, where it ends up at the average current
+  float current;              // A, average
+  float efficiency;           // %, last reading
+  std::uint32_t faults;       // motor_fault_e flags, last reading
+  float timeToDerate;         // s until HEALTH_DERATE_TEMP, -1 = never at this current
+  float cap;                  // 0..1 speed cap
+};
+
+extern motorHealth health[HEALTH_MOTORS];   // written by the monitor task only
+
+float healthDriveCap();       // speed cap for the drivebase, the lower of both sides
+
+float healthIntakeCap();      // speed cap for the intake
+
+extern void healthTaskFnc(void* ignore);    // motor health monitor, started in initialize()
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef ODOMETRY_H_
+#define ODOMETRY_H_
+
+#include "drivebase.hpp"
+
+#define ODOM_TRACK_WIDTH WHEEL_BASE   // distance between the odometer wheels in cm
+#define ODOM_LOOP_MS 10               // odometer task period in ms
+
+// Position of the robot on the field.  x is forward and y to the left of where the
+// robot was when the odometers were reset, theta is the heading in radians with
+// counter clockwise positive (so a clockwise pivotTurn() makes theta smaller).
+struct pose_t {
+  float x;              // cm
+  float y;              // cm
+  float theta;          // radians
+};
+
+void odomReset(pose_t start = {0, 0, 0});   // set the pose and restart tracking
+
+void odomUpdate();                  // read the odometers and update the pose, called
+                                    // by the odometer task every ODOM_LOOP_MS
+
+pose_t getPose();                   // current pose, safe to call from any task
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef PATH_TABLES_H_
+#define PATH_TABLES_H_
+
+// GENERATED by tools/pathgen.cpp from tools/paths.txt - do not edit, run "make paths"
+
+#include "trajectory.hpp"
+
+#define S_CURVE_POINTS 680    // 6.80 sec, 187.0 cm
+extern const trajPoint sCurve[S_CURVE_POINTS];
+
+#define CORNER_RIGHT_POINTS 771    // 7.71 sec, 205.2 cm
+extern const trajPoint cornerRight[CORNER_RIGHT_POINTS];
+
+#endif
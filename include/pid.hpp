@@ -0,0 +1,139 @@
+#ifndef PID_H_
+#define PID_H_
+
+// ------- pid.hpp ---------------------------------------------------------
+//
+// A PID controller which runs on our own fixed rate loop - call step() exactly once
+// every dt seconds.  It is a template so it works with float as well as with the Fixed
+// fixed point type from fixed.hpp, for example:
+//
+//    PID<float> drivePID(0.01);          // 10ms loop
+//    PID<Fixed> drivePID(Fixed(0.01));
+//
+// Fixed saturates instead of wrapping around, so a product too large for Q16.16 is
+// limited, not turned around - "make pidcheck" (tools/pidcheck.cpp) compares both types.
+//
+// On top of a plain PID it has:
+//  - integral clamping, and the integral stops growing while the output is saturated
+//    (anti-windup), so it does not overshoot after a long saturated move
+//  - derivative on measurement, so a change in setpoint does not kick the output
+//  - output limit and output slew limit (maximum change of output per step)
+//  - gains scheduled on speed, interpolated from a table of pidSchedule entries
+
+template <typename T> struct pidGains {
+  T kP;
+  T kI;
+  T kD;
+};
+
+template <typename T> struct pidSchedule {
+  T speed;                    // gains below are tuned for this speed
+  pidGains<T> gains;
+};
+
+template <typename T> class PID {
+  public:
+    explicit PID(T dt) : dt(dt) {}
+
+    void setGains(const pidGains<T> &newGains) { gains = newGains; }
+    pidGains<T> getGains() const { return gains; }
+
+    // table must be sorted by speed, it is not copied so keep it around (const table)
+    void setSchedule(const pidSchedule<T> *table, int count) {
+      schedule = table;
+      scheduleCount = count;
+    }
+
+    // pick the gains for the given speed, interpolating between the table entries
+    void scheduleFor(T speed) {
+      if(schedule == nullptr || scheduleCount <= 0) {
+        return;
+      }
+      if(speed <= schedule[0].speed) {
+        gains = schedule[0].gains;
+        return;
+      }
+      for(int i = 1; i < scheduleCount; i++) {
+        if(speed <= schedule[i].speed) {
+          const pidSchedule<T> &a = schedule[i - 1];
+          const pidSchedule<T> &b = schedule[i];
+          T ratio = (speed - a.speed) / (b.speed - a.speed);
+          gains.kP = a.gains.kP + (b.gains.kP - a.gains.kP) * ratio;
+          gains.kI = a.gains.kI + (b.gains.kI - a.gains.kI) * ratio;
+          gains.kD = a.gains.kD + (b.gains.kD - a.gains.kD) * ratio;
+          return;
+        }
+      }
+      gains = schedule[scheduleCount - 1].gains;
+    }
+
+    void setIntegralLimit(T limit) { integralLimit = limit; }   // 0 = no integral
+    void setOutputLimit(T limit) { outputLimit = limit; }       // +- limit
+    void setSlewLimit(T limit) { slewLimit = limit; }           // 0 = no slew limit
+
+    // start again from the given measurement, call before every new movement
+    void reset(T measurement) {
+      integral = T(0);
+      lastMeasurement = measurement;
+      error = T(0);
+      output = T(0);
+    }
+
+    // one control step, returns the new output
+    T step(T setpoint, T measurement) {
+      error = setpoint - measurement;
+
+      // derivative on measurement - the setpoint does not show up in the D term
+      T derivative = (lastMeasurement - measurement) / dt;
+      lastMeasurement = measurement;
+
+      // only integrate when it does not push an already saturated output further
+      bool saturatedHigh = output >= outputLimit && error > T(0);
+      bool saturatedLow = output <= -outputLimit && error < T(0);
+      if(!saturatedHigh && !saturatedLow) {
+        integral += error * dt;
+      }
+      T iTerm = clamp(gains.kI * integral, integralLimit);
+      if(gains.kI != T(0)) {
+        integral = iTerm / gains.kI;            // keep the stored integral clamped too
+      }
+
+      T newOutput = clamp(gains.kP * error + iTerm + gains.kD * derivative, outputLimit);
+
+      if(slewLimit > T(0)) {
+        newOutput = clamp(newOutput - output, slewLimit) + output;
+      }
+      output = newOutput;
+      return output;
+    }
+
+    T getError() const { return error; }
+    T getOutput() const { return output; }
+
+  private:
+    static T clamp(T value, T limit) {
+      if(value > limit) {
+        return limit;
+      }
+      if(value < -limit) {
+        return -limit;
+      }
+      return value;
+    }
+
+    T dt;
+    pidGains<T> gains = {T(0), T(0), T(0)};
+    const pidSchedule<T> *schedule = nullptr;
+    int scheduleCount = 0;
+
+    T integralLimit = T(0);
+    T outputLimit = T(12000);     // motor voltage limit in mV
+    T slewLimit = T(0);
+
+    T integral = T(0);
+    T lastMeasurement = T(0);
+    T error = T(0);
+    T output = T(0);
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef PLANNER_H_
+#define PLANNER_H_
+
+#include <cstdint>
+#include "trajectory.hpp"
+
+// Finds a route across the field around the field elements.  The field is split into
+// square cells, a cell is blocked when the robot center can not be there without the
+// robot touching something.  A* then searches the shortest route through free cells.
+// This header does not use PROS so host side tools can include it as well.
+//
+// Planner positions are FIELD coordinates: x and y in cm from the field corner on the
+// left behind the robot start, not relative to the robot start like the odometry.
+// Reset the odometry to the field start position (odomReset()) to use them directly.
+
+#define FIELD_SIZE 365.76             // cm, 12 feet
+#define PLAN_CELL 5.0                 // cm per grid cell
+#define PLAN_GRID 74                  // cells per side, PLAN_GRID * PLAN_CELL >= FIELD_SIZE
+#define PLAN_CELLS (PLAN_GRID * PLAN_GRID)
+#define PLAN_ROBOT_RADIUS 28.0        // cm from robot center to its furthest corner
+#define PLAN_MARGIN 5.0               // cm extra room - the smoothed path cuts corners
+#define PLAN_MAX_WAYPOINTS 32
+
+// One bit per cell, 1 = blocked - the whole field fits in 700 bytes
+struct planGrid {
+  std::uint32_t bits[(PLAN_CELLS + 31) / 32];
+};
+
+// A field element, as a rectangle in field coordinates
+struct planObstacle {
+  float x0;                           // cm, corner with the smallest x and y
+  float y0;
+  float x1;                           // cm, opposite corner
+  float y1;
+};
+
+void planInit();                      // build the inflated field map once from the
+                                      // obstacle table in planner.cpp - call in initialize()
+
+void planAddObstacle(const planObstacle &obstacle);   // block an extra area (inflated),
+                                      // for example a robot parked on the field
+
+bool planBlocked(float x, float y);   // true if the robot center may not be at x, y
+
+// Plan a route from start to goal (cm, field coordinates).  The route is written as
+// waypoints (x and y only) for pathFromWaypoints() or trajCacheGet(), only the corners
+// are kept.  Returns the number of waypoints, 0 if there is no route.
+int planRoute(float startX, float startY, float goalX, float goalY,
+              pathSample* waypoints, int maxWaypoints);
+
+#endif
@@ -5,6 +5,7 @@
 #define RIGHT_MOTOR_PORT  1
 
 #define INTAKE_MOTOR_PORT 5
+#define INTAKE_OPTICAL_PORT 6
 
 #define LEFT_ODOM_PORT 9
 #define RIGHT_ODOM_PORT 2
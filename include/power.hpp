@@ -0,0 +1,39 @@
+#ifndef POWER_H_
+#define POWER_H_
+
+#include <cstdint>
+#include "motorhealth.hpp"            // healthMotor_e, the same motor numbers
+
+#define POWER_LOOP_MS 10              // one control loop, a new budget every tick
+#define POWER_MOTOR_MAX_MA 2500       // most a V5 motor can take
+#define POWER_BUDGET_MA (HEALTH_MOTORS * POWER_MOTOR_MAX_MA)   // CHANGE to the share of
+                                      // the brain's motor current these motors may use
+                                      // together - all of them at full current limits
+                                      // nothing, lower it when more motors share the brain
+#define POWER_MIN_MA 400              // every motor keeps at least this
+#define POWER_HEADROOM_MA 300         // above the demand, so a motor is not limited by a
+                                      // small error in the estimate
+#define POWER_INTAKE_FREE_RPM 200     // intake motor speed at 12V (green cartridge)
+#define POWER_ACCEL_MV 1500           // mV above the back emf that counts as accelerating
+#define POWER_COMMAND_MS 30           // a drive voltage older than this is not driving
+#define POWER_PRIORITY 3.0            // weight of an accelerating drive side or an intake
+                                      // picking up, the rest have weight 1
+#define POWER_LIMIT_STEP 50           // mA - smaller changes are not sent to the motor
+
+// A current budget for the motors.  Every POWER_LOOP_MS the power manager estimates how
+// much current each motor needs right now, and shares POWER_BUDGET_MA out with
+// set_current_limit(): the drive gets more while it accelerates, the intake more while it
+// picks up or clears a jam.  When the demand fits, every motor gets what it needs and a
+// part of what is left over.
+//
+// The drive voltages are reported by driveSetVoltage() (drivebase.cpp) as they are sent,
+// so a new demand is in the budget of the next tick.
+
+extern float powerDemand[HEALTH_MOTORS];        // mA, estimated need of each motor
+extern std::int32_t powerLimit[HEALTH_MOTORS];  // mA, current limit given to each motor
+
+void powerDriveCommand(float leftVoltage, float rightVoltage);  // mV sent to the drive
+
+extern void powerTaskFnc(void* ignore);         // power manager, started in initialize()
+
+#endif
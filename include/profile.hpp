@@ -0,0 +1,29 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+// A trapezoidal motion profile: accelerate at maxAccel until maxVel, cruise, and
+// decelerate to stop exactly at the distance.  Short moves never reach maxVel and
+// become a triangle.  This header does not use PROS so host tools can use it too.
+
+struct motionProfile {
+  float distance;       // signed distance (cm or any unit)
+  float maxVel;         // unit/s, always positive
+  float maxAccel;       // unit/s^2, always positive
+  float accelTime;      // time spent accelerating (same as decelerating)
+  float cruiseTime;     // time spent at cruise velocity
+  float cruiseVel;      // highest velocity reached
+};
+
+struct profilePoint {
+  float position;
+  float velocity;
+  float acceleration;
+};
+
+motionProfile profileCreate(float distance, float maxVel, float maxAccel);
+
+float profileDuration(const motionProfile &profile);                // seconds
+
+profilePoint profileSample(const motionProfile &profile, float t);  // t in seconds
+
+#endif
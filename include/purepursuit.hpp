@@ -0,0 +1,62 @@
+#ifndef PURE_PURSUIT_H_
+#define PURE_PURSUIT_H_
+
+#include "odometry.hpp"
+
+#define PP_MAX_POINTS 200         // maximum number of points in a path
+#define PP_SPACING 5.0            // cm between the points we fill in between waypoints
+#define PP_MIN_LOOKAHEAD 15.0     // cm - lookahead when driving slow
+#define PP_MAX_LOOKAHEAD 40.0     // cm - lookahead when driving fast
+#define PP_LOOKAHEAD_GAIN 0.8     // extra lookahead in cm per cm/s of speed
+#define PP_TURN_SPEED 4.0         // speed limit in corners: v <= PP_TURN_SPEED / curvature
+#define PP_MIN_SPEED 5.0          // cm/s - never slower, or we would not get to the end
+#define PP_VEL_KP 150.0           // mV per cm/s of wheel velocity error
+#define PP_END_TOLERANCE 2.0      // cm from the last point to be done
+
+struct ppPoint {
+  float x;                        // cm
+  float y;                        // cm
+};
+
+// A path with points filled in every PP_SPACING cm.  Create it once with ppPathCreate(),
+// preferably as a static or global variable as it is fairly big.
+struct ppPath {
+  ppPoint points[PP_MAX_POINTS];
+  float curvature[PP_MAX_POINTS]; // 1/cm, how sharp the path bends at each point
+  float remaining[PP_MAX_POINTS]; // cm left to drive from each point to the end
+  int count;
+};
+
+void ppPathCreate(ppPath &path, const ppPoint* waypoints, int count);
+
+// Follows a path with pure pursuit: every loop we pick the point on the path one
+// lookahead distance ahead and drive the arc which goes through it.  Like DriveMove
+// call start() once and step() every DRIVE_LOOP_MS until it returns true.
+class PathFollower {
+  public:
+    void start(const ppPath &path, int speed, bool reverse = false);  // speed in RPM
+    bool step();                  // one control loop, returns true when finished
+    bool isDone();
+    float getTravelled();         // cm along the path so far
+    void stop();
+
+  private:
+    bool findLookahead(pose_t pose, float lookahead, ppPoint &target);
+
+    const ppPath* path = nullptr;
+    float maxVel;                 // cm/s
+    bool reverse;
+    int closest;                  // index of the closest point, only ever moves forward
+    int lookIndex;                // segment of the last lookahead point
+    float lookFraction;           // how far along that segment it was (0-1)
+    ppPoint goal;                 // last lookahead point
+    float velocity;               // cm/s we are asking for
+    float lastLeftVel;
+    float lastRightVel;
+    std::uint32_t timeout;
+    bool done = true;
+};
+
+void followPath(const ppPath &path, int speed, bool reverse = false);   // blocking
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef RAMSETE_H_
+#define RAMSETE_H_
+
+#include "odometry.hpp"
+#include "trajectory.hpp"
+
+#define RAMSETE_B 0.0002          // correction strength, 2.0 1/m^2 in 1/cm^2
+#define RAMSETE_ZETA 0.7          // damping, between 0 and 1
+#define RAMSETE_MIN_K 2.0         // 1/s - keeps correcting when the trajectory stops
+#define RAMSETE_VEL_KP 150.0      // mV per cm/s of wheel velocity error
+#define RAMSETE_TOLERANCE 0.5     // cm from the end point to be done
+#define RAMSETE_SETTLE_MS 500     // ms we may keep correcting after the last point
+
+// Follows a trajectory (trajectory.hpp) with the RAMSETE controller.  The trajectory says
+// where we should be at every moment, RAMSETE compares that with the odometry pose and
+// bends the velocities to steer back onto the trajectory.  Like DriveMove call start()
+// once and step() every TRAJ_DT_MS until it returns true.
+class TrajectoryFollower {
+  public:
+    void start(const trajPoint* trajectory, int count);
+    bool step();                  // one control loop, returns true when finished
+    bool isDone();
+    float getTravelled();         // cm along the trajectory so far
+    void stop();
+
+  private:
+    const trajPoint* trajectory = nullptr;
+    int count = 0;
+    std::uint32_t startTime;
+    float travelled;
+    bool done = true;
+};
+
+void followTrajectory(const trajPoint* trajectory, int count);   // blocking
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef RECORDER_H_
+#define RECORDER_H_
+
+#include <cstdint>
+#include "trajectory.hpp"
+
+#define RECORD_LOOP_MS TRAJ_DT_MS     // one sample for every trajectory point (10ms)
+#define RECORD_MAX_SAMPLES 12000      // 2 minutes, 120KB
+#define RECORD_MAGIC 0x44524352       // "RCRD" - first 4 bytes of every recording
+#define RECORD_VERSION 2              // 2: positions in 2mm steps, version 1 had mm
+#define RECORD_POSITION_SCALE 5       // position steps per cm (2mm), +-655cm fits in int16
+#define RECORD_STOP_BUTTON pros::E_CONTROLLER_DIGITAL_B   // driver ends the recording
+
+// Record what the driver drives and play it back as an autonomous.  Every RECORD_LOOP_MS
+// the recorder takes the pose (odometry.cpp) and the velocity of both odometer wheels
+// (velocity.cpp); when the recording ends it is written to the SD card in one go.
+// Played back, the recording is a trajectory: the pose of every sample is where the
+// robot should be at that moment, and RAMSETE (ramsete.cpp) steers back onto it.
+//
+// File layout: recordHeader followed by count recordSamples, exactly as in memory.
+// Numbers are 2mm steps, mm/s and 1/10000 radians to keep a sample at 10 bytes - whole
+// mm would end at 327cm, less than the 366cm field.
+
+struct recordHeader {
+  std::uint32_t magic;            // RECORD_MAGIC
+  std::uint16_t version;          // RECORD_VERSION
+  std::uint16_t dtMs;             // time between samples, RECORD_LOOP_MS
+  std::uint32_t count;            // number of recordSamples following the header
+};
+
+struct recordSample {
+  std::int16_t x;                 // 2mm steps (RECORD_POSITION_SCALE)
+  std::int16_t y;                 // 2mm steps
+  std::int16_t theta;             // 1/10000 radians, between -pi and pi
+  std::int16_t left;              // mm/s left odometer wheel
+  std::int16_t right;             // mm/s right odometer wheel
+};
+
+extern bool recording;            // true while the recorder task runs
+
+void recordStart(const char* name = "replay");  // start recording to /usd/<name>.rec
+
+void recordStop();                // end the recording and save it (RECORD_STOP_BUTTON
+                                  // does the same)
+
+// Read /usd/<name>.rec into a trajectory for followTrajectory().  Returns the number
+// of points, 0 if there is no (valid) recording.
+int recordLoad(const char* name, trajPoint* trajectory, int maxPoints);
+
+extern void recordTaskFnc(void* ignore);    // the recorder, started by recordStart()
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SPLINE_H_
+#define SPLINE_H_
+
+#include "trajectory.hpp"
+
+// A spline path goes exactly through a list of poses (position and heading), one quintic
+// curve between every two poses.  Unlike smoothed waypoints the robot also arrives at
+// each pose facing the given direction.
+// This header does not use PROS so host side tools can include it as well.
+
+#define SPLINE_MAX_SEGMENTS 16        // so at most 17 poses per path
+#define SPLINE_TABLE_STEPS 32         // arc length table entries per segment
+#define SPLINE_TANGENT_SCALE 1.2      // tangent length as part of the distance between
+                                      // poses - longer makes wider curves
+
+struct splinePose {
+  float x;                            // cm
+  float y;                            // cm
+  float theta;                        // radians, counter clockwise positive
+};
+
+// x(t) = ax[0] + ax[1] t + ... + ax[5] t^5 for t from 0 to 1, the same for y
+struct splineSegment {
+  float ax[6];
+  float ay[6];
+};
+
+struct splinePath {
+  splineSegment segments[SPLINE_MAX_SEGMENTS];
+  int segmentCount;
+  // length[k] = cm along the path at segment k / SPLINE_TABLE_STEPS,
+  // t = (k % SPLINE_TABLE_STEPS) / SPLINE_TABLE_STEPS
+  float length[SPLINE_MAX_SEGMENTS * SPLINE_TABLE_STEPS + 1];
+};
+
+bool splineCreate(splinePath &path, const splinePose* poses, int count);  // false if
+                                      // less than 2 or more than SPLINE_MAX_SEGMENTS+1 poses
+
+float splineLength(const splinePath &path);       // total length in cm
+
+// Point on the path at the given distance (cm) from the start, with the exact heading
+// and curvature - velocity and time are left at 0
+pathSample splineAt(const splinePath &path, float distance);
+
+// Fill samples every spacing cm along the path, ready for trajGenerate().  Returns the
+// number of samples written.
+int splineSample(const splinePath &path, pathSample* samples, int maxSamples, float spacing);
+
+#endif
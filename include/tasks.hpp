@@ -6,6 +6,12 @@ extern pros::task_t intake;
 extern pros::task_t drive;
 extern pros::task_t odom;
 extern pros::task_t display;
+extern pros::task_t velocity;
+extern pros::task_t optical;
+extern pros::task_t record;
+extern pros::task_t monitor;
+extern pros::task_t battery;
+extern pros::task_t power;
 
 // task specific managment functions
 extern void killTasks();                    // kill all running tasks
@@ -13,10 +19,6 @@ extern void displayTaskFnc(void* ignore);   // display counter of all running ta
 extern void odomTaskFnc(void* ignore);      // odometer task
 
 // task global variables used to synchronize between tasks
-extern bool runIntakeNow;           // stop / start the intake conveyer
-
-extern bool reverseIntake;          // reverse intake direction
-
 extern bool odomResetFlag;
 
 #endif
@@ -0,0 +1,22 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#define TELEMETRY_MAX_SAMPLES 3000    // 30 sec of samples at 10ms
+#define TELEMETRY_CHANNELS 8          // maximum number of values per sample
+
+// Records samples into a fixed buffer while the robot runs, nothing is written to the
+// SD card until telemetrySave() is called - file writes are far too slow to do in a
+// control loop.
+
+void telemetryStart(const char* name, const char* columns);  // name of the log file
+                                      // (without .csv) and comma separated column names
+
+void telemetryRecord(const float* values, int count);        // add one sample, the
+                                      // time stamp (ms) is added in front automatically
+
+bool telemetrySave();                 // write the samples to /usd/<name>.csv, or to the
+                                      // terminal if no SD card is installed
+
+int telemetryCount();                 // number of samples recorded
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef TRACTION_H_
+#define TRACTION_H_
+
+#define ODOM_WHEEL_DIAM 7     // diameter in cm of the unpowered odometer wheels
+
+#define SLIP_MIN_SPEED 5.0    // cm/s - below this speed we do not judge slip
+#define SLIP_RATIO 0.15       // motor wheel more than 15% faster than odom = slip
+#define SLIP_SAMPLES 2        // number of consecutive samples before we call it slip
+
+#define TRACTION_SLIP_TIMESCALE 0.5   // while slipping the motion profile runs at
+                                      // half speed, which lowers the acceleration
+
+extern bool leftSlipping;             // true while left drive wheel is slipping
+extern bool rightSlipping;            // true while right drive wheel is slipping
+extern float leftSlipLoss;            // cm the left motor turned without the robot
+extern float rightSlipLoss;           // moving (discounted from encoder distance)
+extern int slipSampleCount;           // number of samples flagged as slipping
+
+void tractionReset();                 // reset slip state, call at start of movement
+
+bool tractionUpdate();                // compare motor encoders with odometers, call
+                                      // every control tick - returns true on slip
+
+float tractionTimeScale();            // how fast the motion profile may advance,
+                                      // 1.0 when gripping - less while slipping
+
+#endif
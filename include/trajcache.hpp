@@ -0,0 +1,36 @@
+#ifndef TRAJCACHE_H_
+#define TRAJCACHE_H_
+
+#include <cstdint>
+#include "trajectory.hpp"
+
+#define TRAJ_CACHE_DIR "/usd/paths"   // cache folder, create it once on the SD card
+#define TRAJ_CACHE_MAGIC 0x4A415254   // "TRAJ" - first 4 bytes of every cache file
+#define TRAJ_CACHE_VERSION 1          // bump when trajPoint or the generator changes
+#define TRAJ_CACHE_MAX_SAMPLES 2000   // path samples used while generating, 100m of path
+
+// Trajectories made on the brain from waypoints take a while to generate, so the result
+// is stored on the SD card, named after a hash of everything that went into it.  On the
+// next boot the same waypoints and constraints give the same hash and the trajectory is
+// read back instead of generated again.  Change a single waypoint or limit and the hash
+// changes, so an old file is never used by mistake.
+//
+// File layout: trajCacheHeader followed by count trajPoints, exactly as they are in memory.
+
+struct trajCacheHeader {
+  std::uint32_t magic;            // TRAJ_CACHE_MAGIC
+  std::uint32_t version;          // TRAJ_CACHE_VERSION
+  std::uint32_t hash;             // trajCacheHash() of the waypoints and constraints
+  std::uint32_t count;            // number of trajPoints following the header
+};
+
+std::uint32_t trajCacheHash(const pathSample* waypoints, int count,
+                            const trajConstraints &constraints);   // FNV-1a hash
+
+// Load the trajectory for these waypoints from the SD card, or generate it (and save it
+// for next time) when there is no matching file.  Returns the number of points written
+// to trajectory, 0 if it could not be made.
+int trajCacheGet(const pathSample* waypoints, int count, const trajConstraints &constraints,
+                 trajPoint* trajectory, int maxPoints);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef TRAJECTORY_H_
+#define TRAJECTORY_H_
+
+// A trajectory is a list of where the robot should be every TRAJ_DT_MS, and how fast it
+// should be going there.  Point i is the state at time i * TRAJ_DT_MS, so a follower
+// finds its point with a single division instead of a search.
+// This header does not use PROS so host side tools can include it as well.
+
+#define TRAJ_DT_MS 10             // time between two trajectory points in ms
+
+struct trajPoint {
+  float x;                        // cm
+  float y;                        // cm
+  float theta;                    // radians, counter clockwise positive
+  float v;                        // cm/s forward velocity
+  float omega;                    // rad/s turn rate, counter clockwise positive
+  float a;                        // cm/s^2 forward acceleration
+};
+
+// A path sample is one point of a curve, closely spaced (a cm or so apart).  Only x and y
+// have to be filled in - pathComputeGeometry() works out the rest - or a spline can fill
+// in the exact heading and curvature itself.
+struct pathSample {
+  float x;                        // cm
+  float y;                        // cm
+  float theta;                    // radians, direction of the path
+  float curvature;                // 1/cm, + is bending to the left
+  float s;                        // cm along the path from the first sample
+  float velocity;                 // cm/s - filled in by trajGenerate()
+  float time;                     // seconds to get here - filled in by trajGenerate()
+};
+
+// Limits for the robot while driving a trajectory
+struct trajConstraints {
+  float maxVel;                   // cm/s of the robot center
+  float maxAccel;                 // cm/s^2 of the robot center
+  float maxWheelVel;              // cm/s - the outside wheel goes faster in a curve
+  float trackWidth;               // cm between the wheels, normally WHEEL_BASE
+};
+
+#define PATH_SPACING 5.0          // cm between samples made by pathFromWaypoints()
+#define PATH_SMOOTH_DATA 0.25     // how much the smoothed path is pulled to the waypoints
+#define PATH_SMOOTH_SMOOTH 0.75   // how much each sample is pulled to its neighbours
+#define PATH_SMOOTH_TOLERANCE 0.001   // stop smoothing once samples move less than this
+
+void pathComputeGeometry(pathSample* samples, int count);   // fill in theta, curvature, s
+
+// Join waypoints (only x, y used) with straight lines, fill in a sample every PATH_SPACING
+// cm and smooth the corners into curves.  Returns the number of samples written.
+int pathFromWaypoints(const pathSample* waypoints, int count, pathSample* samples, int maxSamples);
+
+// Time-parameterize a path: work out the fastest velocity at every sample within the
+// constraints (stored in the samples), then write a point every TRAJ_DT_MS into
+// trajectory.  Returns the number of points written, at most maxPoints (the trajectory
+// is cut short if it does not fit).
+int trajGenerate(pathSample* samples, int count, const trajConstraints &constraints,
+                 trajPoint* trajectory, int maxPoints);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef TRIGGERS_H_
+#define TRIGGERS_H_
+
+#include "intake.hpp"
+
+#define TRIGGER_MAX 16                // pending triggers of each kind
+
+// Triggers fire an action part way through the next drive motion (driveForDistance,
+// pivotTurn, followPath, followTrajectory), for example "start the intake at 60cm".
+// Add them right before the motion, they are checked every control tick of it.
+// Triggers which did not fire by the end of the motion are dropped.
+//
+// The action is either a callback, which runs in the task driving the robot so it has
+// to be quick, or an intake event which is posted to the intake task.
+
+typedef void (*triggerCallback)(void* arg);
+
+// fire once the motion travelled this many cm (either direction)
+void triggerAtDistance(float distance, triggerCallback callback, void* arg = nullptr);
+void triggerAtDistance(float distance, intakeEvent_e event);
+
+// fire once the robot turned this many degrees since the start of the motion (either
+// direction) - needs the odometry task running
+void triggerAtHeading(float degrees, triggerCallback callback, void* arg = nullptr);
+void triggerAtHeading(float degrees, intakeEvent_e event);
+
+// fire once the robot center is within radius cm of x, y (odometry pose).  These fire
+// in the order they were added, so add them in the order the robot passes them.
+void triggerInRadius(float x, float y, float radius, triggerCallback callback, void* arg = nullptr);
+void triggerInRadius(float x, float y, float radius, intakeEvent_e event);
+
+void triggersClear();                 // drop all pending triggers
+
+// used by the drive motions themselves
+void triggersBegin();                 // a motion starts - take the start heading
+void triggersCheck(float travelled);  // every control tick, travelled in cm
+void triggersEnd();                   // the motion ended - drop what did not fire
+
+#endif
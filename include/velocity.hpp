@@ -0,0 +1,75 @@
+#ifndef VELOCITY_H_
+#define VELOCITY_H_
+
+#include "main.h"
+#include <memory>
+
+namespace okapi { class VelMath; }      // only velocity.cpp needs the full okapi headers
+
+#define VELOCITY_SAMPLE_MS 10       // rotation sensor native update rate in ms
+
+#define VEL_EMA_ALPHA 0.3           // EMA / DEMA smoothing, 1.0 = no smoothing
+#define VEL_MEDIAN_SIZE 5           // number of samples in the median window
+#define VEL_TRACK_KP 60.0           // tracking loop position gain (1/s)
+#define VEL_TRACK_KI 900.0          // tracking loop velocity gain (1/s^2)
+
+// filters we can select for a velocity estimator
+enum velFilter_e {
+  VEL_FILTER_NONE,            // raw value, no filtering
+  VEL_FILTER_OKAPI,           // OkapiLib velMath (position differencing)
+  VEL_FILTER_EMA,             // exponential moving average
+  VEL_FILTER_DEMA,            // double exponential moving average (less lag)
+  VEL_FILTER_MEDIAN,          // median of last VEL_MEDIAN_SIZE samples (spike removal)
+  VEL_FILTER_TRACKING         // tracking loop observer on the position
+};
+
+// where the raw velocity for NONE / EMA / DEMA / MEDIAN comes from
+enum velSource_e {
+  VEL_SOURCE_SENSOR,          // pros::Rotation::get_velocity()
+  VEL_SOURCE_DIFF             // difference of two position readings
+};
+
+class VelocityEstimator {
+  public:
+    VelocityEstimator(pros::Rotation &sensor, float wheelDiam,
+                      velFilter_e filter = VEL_FILTER_TRACKING,
+                      velSource_e source = VEL_SOURCE_SENSOR);
+    ~VelocityEstimator();
+
+    void setFilter(velFilter_e filter, velSource_e source = VEL_SOURCE_SENSOR);
+    void reset();               // restart filters from the current position
+
+    float step();               // read sensor and update, call every VELOCITY_SAMPLE_MS
+    float getVelocity();        // last estimated wheel velocity in cm/s
+
+  private:
+    float rawVelocity(std::int32_t position, std::int32_t sensorVel, float dt);
+
+    pros::Rotation &sensor;
+    float cmPerCentiDeg;        // wheel travel for one sensor unit
+    velFilter_e filter;
+    velSource_e source;
+
+    float velocity = 0;         // filter output in centidegrees/s
+    std::int32_t lastPosition = 0;
+    std::uint32_t lastTime = 0;
+    bool started = false;
+
+    float ema1 = 0;             // EMA / DEMA state
+    float ema2 = 0;
+
+    float window[VEL_MEDIAN_SIZE] = {0};  // median ring buffer
+    int windowIndex = 0;
+
+    float trackPos = 0;         // tracking loop state
+    float trackVel = 0;
+
+    std::unique_ptr<okapi::VelMath> velMath;  // created once in setFilter()
+};
+
+extern VelocityEstimator leftOdomVelocity;      // left odometer wheel velocity
+extern VelocityEstimator rightOdomVelocity;     // right odometer wheel velocity
+
+extern void velocityTaskFnc(void* ignore);      // update both estimators at sensor rate
+
+#endif
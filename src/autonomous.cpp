@@ -16,10 +16,24 @@
 #include "intake.hpp"           // intake functions including intake task definition
 #include "autonomous.hpp"
 #include "tasks.hpp"            // ensure access to tasks definition for our code
+#include "characterize.hpp"     // drivebase characterization routine
+#include "purepursuit.hpp"      // path following
+#include "ramsete.hpp"          // trajectory following
+#include "pathtables.hpp"       // trajectories generated by "make paths"
+#include "trajcache.hpp"        // trajectories generated on the brain, cached on SD
+#include "planner.hpp"          // A* route planning around the field elements
+#include "command.hpp"          // command based routines
+#include "autoscript.hpp"       // routines loaded from the SD card
+#include "recorder.hpp"         // routes recorded while driving
 
 // --------------------- autonomous skill code ---------------------------------------
 // This function is supposed to be called in the autonomous() portion of the main.cpp code
 // when running just a two minute long autonomous portion of a competition
+//
+// The routines below are written as a tree of commands (see command.cpp): we first build
+// the whole routine, then commandRun() runs it.  Each command says what to do, not how to
+// wait for it - the scheduler steps all running commands every 10ms, so things inside a
+// cmdParallel / cmdDeadline / cmdRace happen at the same time.
 
 void autoSkill() {
   // This is the 2 minute autonomous function code section, call
@@ -27,78 +41,41 @@ void autoSkill() {
   motorMaxSpeed = 25;			// Lets set the max speed of movement, remember it is
                           // a glbal variabel see globals.cpp/globals.hpp
 
-
-  // Now lets move the robot forward for a bit.  We use relative movement here, so we
-  // move encoder unit increments no matter what are current encoder count is, as
-  // we specified E_MOTOR_ENCODER_DEGREES in motor setup we will rotate the motor 1000 degrees
-  // See here for more detail: https://pros.cs.purdue.edu/v5/api/cpp/motors.html#move-relative
-
-  // We should ensure that the eoncoders start at 0, this makes it easier to visualize and ensure
-  // motors move for the given requested distance
-  left_wheel.tare_position();       // ensure encoders are reset before
-  right_wheel.tare_position();      // movement.
-
-  right_wheel.move_relative(1000, motorMaxSpeed);		// Move forward for 1000 encoder units
-  left_wheel.move_relative(1000, motorMaxSpeed);
-  // Important to understnad - we need to let the motor run it's course and ensure that it gets within
-  // +-5  if we do not do that it would randomly either directly move on to the next movement or
-  // never execute what comes next, as it will NEVER precisely reach the requested encoder units
-  while (!((left_wheel.get_position() < 1005) && (left_wheel.get_position() > 995))) {
-    // Continue running this loop as long as the motor is not within +-5 units of its goal
-    pros::delay(2);
+  // A script on the SD card (see autoscript.cpp) wins over the routine below, it was
+  // read from the card at startup (see initialize() in main.cpp)
+  if(scriptLoaded(SCRIPT_SLOT_SKILL)) {
+    killTasks();
+    intake = pros::Task (intakeTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT,
+                  TASK_STACK_DEPTH_DEFAULT, "Intake Task"); // scripts may use the intake
+    scriptRun(SCRIPT_SLOT_SKILL);
+    return;
   }
-  // Lets print out the encoder values after the movement is completed, notice that it will have a
-  // value whihc is within +-5 units of request, likely slight below the requested vaule
-  // To view this output ensure hte V5 is connected via USB cable to your computer
-  // and open the Consoel Terminal (menu PROS -> Open Terminal)
-  std::cout << "After forward: Encoder left: " << left_wheel.get_position() << "\n";
 
-  // lets make a turn to the left, meaning we are only going to spin the left motor
-  left_wheel.tare_position();       // ensure encoders are reset before
-  right_wheel.tare_position();      // movement.
+  // The built in routine, used when there is no script on the card.  KEEP IN STEP with
+  // its copy tools/autos/autoSkill.txt - "make autotime" only times that copy, a change
+  // made here only is not checked against the 2 minutes.
 
-  // let set a new motorMaxSpeed and lets check if it is allowed, if not we set it to the
+  // let set a speed for the turn and lets check if it is allowed, if not we set it to the
   // maximum allowable speed.
-  motorMaxSpeed = 300;
-  if(motorMaxSpeed > maxAllowedSpeed) {
+  int turnSpeed = 300;
+  if(turnSpeed > maxAllowedSpeed) {
     // Oops we are exceeding maximum value.....
-    motorMaxSpeed = maxAllowedSpeed;							// setting to the max maxAllowedSpeed
-  }
-  // for fun lets print what the speed is
-  std::cout << "Motospeed is set to: " << motorMaxSpeed << "\n";
-
-  left_wheel.move_relative(1000, motorMaxSpeed);
-  while (!((left_wheel.get_position() < 1005) && (left_wheel.get_position() > 995))) {
-    // Continue running this loop as long as the motor is not within +-5 units of its goal
-    pros::delay(2);
-  }
-  std::cout << "After turn: Encoder left: " << left_wheel.get_position() << "\n";
-
-  // Lest drive backwards for a movement, we are going to give it negative encoder counts
-  // This also means our while wait loop needs to change to reflect in thsi case -1005 and -995
-  // and the > and < signs flip!
-
-  // Lets set out speed to the default
-  motorMaxSpeed = motorDefaultSpeed;									// comes from globals.cpp
-
-  // for fun lets print what the speed is
-  std::cout << "Motospeed is set to: " << motorMaxSpeed << "\n";
-
-  left_wheel.tare_position();       // ensure encoders are reset before
-  right_wheel.tare_position();      // movement.
-
-  right_wheel.move_relative(-1000, motorMaxSpeed);		// Move forward for 1000 encoder units
-  left_wheel.move_relative(-1000, motorMaxSpeed);
-
-  while (!((left_wheel.get_position() > -1005) && (left_wheel.get_position() < -995))) {
-    // Continue running this loop as long as the motor is not within +-5 units of its goal
-    pros::delay(2);
+    turnSpeed = maxAllowedSpeed;							// setting to the max maxAllowedSpeed
   }
-  std::cout << "After drive Backwards: Encoder left: " << left_wheel.get_position() << "\n";
 
-  // We could ensure that robot is completely stopped by issuing the following commands to the motors:
-  left_wheel.move_velocity(0);
-  right_wheel.move_velocity(0);
+  // 61cm is 1000 degrees of motor rotation with our 7cm wheels: (61 / (3.14 * 7)) * 360
+  // To view the printed output ensure hte V5 is connected via USB cable to your computer
+  // and open the Consoel Terminal (menu PROS -> Open Terminal)
+  commandPoolReset();                     // forget the commands of an earlier routine
+  Command* routine = cmdSequence({
+    cmdDrive(61, motorMaxSpeed),          // forward for 61cm
+    cmdPrint("After forward"),
+    cmdDriveSides(61, 0, turnSpeed),      // turn by only spinning the left wheel
+    cmdPrint("After turn"),
+    cmdDrive(-61, motorDefaultSpeed),     // backwards at our default speed (globals.cpp)
+    cmdPrint("After drive Backwards")
+  });
+  commandRun(routine);
 }
 
 // ------------------ 45 sec autonomous routine -------------------------------------------
@@ -109,48 +86,200 @@ void auto45sec() {
   // This is the 45 sec autonomous code function, call
   // this function when you need to run the 45 sec autonomous.
 
-  // Lets use our new drivebase.cpp defined function to drive for a given distance
-	// Lets drive for 100cm - can you predict the encoder values?
-	if(DEBUG) {std::cout << "Drivebase function: 100cm and speed 65 will be called \n"; }
-	driveForDistance(100, 65);
-	std::cout << "Finished drive for distance of 100cm at 65RPM speed \n";
-
-  // Lets drive backwards for 25cm, at full speed (100rpm)
-  if(DEBUG) {std::cout << "Drivebase function: -25cm and speed 100 will be called \n"; }
-  driveForDistance(-25, 100);
-  std::cout << "Finished drive for distance of -25cm (backwards) at 100RPM speed \n";
+  // A script on the SD card (see autoscript.cpp) wins over the routine below, so the
+  // routine can be changed at an event without uploading a new program
+  if(scriptLoaded(SCRIPT_SLOT_AUTO45)) {
+    killTasks();
+    intake = pros::Task (intakeTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT,
+                  TASK_STACK_DEPTH_DEFAULT, "Intake Task"); // scripts may use the intake
+    scriptRun(SCRIPT_SLOT_AUTO45);
+    return;
+  }
 
+  // The built in routine, used when there is no script on the card.  KEEP IN STEP with
+  // its copy tools/autos/auto45sec.txt - "make autotime" only times that copy, a change
+  // made here only is not checked against the 45 seconds.
+  commandPoolReset();
+  Command* routine = cmdSequence({
+    cmdPrint("Drive for 100cm at 65RPM"),
+    cmdDrive(100, 65),                    // can you predict the encoder values?
+    cmdPrint("Drive for -25cm (backwards) at 100RPM"),
+    cmdDrive(-25, 100),                   // backwards at full speed (100rpm)
+    cmdPrint("Finished 45 sec autonomous")
+  });
+  commandRun(routine);
 }
 
 // -------------------- autonomous task based code sample -----------------------------------
-// This example function runs an autonomous routine which uses tasks to allow for the
-// ´parallel´functionailty between two or more subsystems
+// This example function runs the drivebase and intake at the same time.  The intake
+// itself is a task (its state machine, see intake.cpp), the route is a command tree -
+// the same route as driveTaskFnc() in drivebase.cpp, which does it with its own task.
+
+static bool intakeFull() {
+  return intakeGetState() == INTAKE_HOLDING;
+}
 
 void autoTask(){
-  // Since we will be using tasks in this sample code, we first need to ensure all
-  // tasks are stopped - the only running task should be the display task and the odometer
-  // tasks which will stay active and show the current running tasks counter and odometer
-  // readings to the console - They are not killed with the killTask() function.
+  // We first need to ensure all tasks are stopped - the only running tasks should be
+  // the display task and the odometer tasks which will stay active and show the current
+  // running tasks counter and odometer readings to the console - They are not killed
+  // with the killTask() function.
   killTasks();
 
   // reset the odometers -- we communicate via global to the odometer task
   odomResetFlag = true;
 
-  runIntakeNow = false;     // ensure intake task does not start intake mechanism
-                            // until asked todo so!
-
-  // Lets start a intake task here
+  // Lets start the intake task here, it starts in IDLE and does not run the intake
+  // mechanism until a command posts an event asking it todo so!
 	intake = pros::Task (intakeTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT,
 								TASK_STACK_DEPTH_DEFAULT, "Intake Task"); //starts the task
 	                               // no need to provide any other parameters
 
-  // Lets start a intake task here
-	drive = pros::Task (driveTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT,
-								TASK_STACK_DEPTH_DEFAULT, "Drive Task"); //starts the task
-	                               // no need to provide any other parameters
+  commandPoolReset();
+  Command* routine = cmdSequence({
+    cmdIntake(INTAKE_EV_STOP),            // intake stopped
+    cmdDrive(100, 50),                    // move forward for 100cm at 50RPM
+    cmdDeadline({                         // the drive sets the deadline:
+      cmdDrive(50, 50),                   // move forward for 50cm at 50RPM
+      cmdIntakeRun()                      // and run the intake as long as it drives
+    }),
+    cmdParallel({                         // at the same time:
+      cmdTurn(90, 25),                    // make 90 degree clockwise turn at 25 RPM
+      cmdIntake(INTAKE_EV_OUTTAKE)        // and run the intake counter clockwise
+    }),
+    cmdIntake(INTAKE_EV_INTAKE),          // intake back to clockwise
+    cmdRace({                             // whichever comes first:
+      cmdWait(300),                       // run the intake for 300ms
+      cmdWaitUntil(intakeFull)            // or until the intake is full
+    }),
+    cmdIntake(INTAKE_EV_STOP),            // stop intake
+    cmdDrive(-100, 50)                    // drive backwards for 100cm at 50RPM
+  });
+  commandRun(routine);
+}
+
+// -------------------- drivebase characterization ------------------------------------------
+// Not a competition routine - this drives the robot through voltage ramps, steps and a
+// turn in place to measure the feedforward constants, wheel diameter and track width.
+// Results are printed to the terminal and the raw samples saved to /usd/characterize.csv
+
+void autoCharacterize() {
+  killTasks();                      // nothing else may drive the motors
+  characterizeDrive();
+}
+
+// -------------------- pure pursuit path sample ----------------------------------------
+// The same route as the start of driveTaskFnc() - 150cm forward and a 90 degree turn -
+// but as one smooth path, the robot does not have to stop to pivot in the corner.
+// Waypoints are in cm, x forward and y to the left of the start position.
+
+static ppPath samplePath;             // static - a path is too big for the task stack
+
+void autoPursuit() {
+  killTasks();
+  odomReset();                        // we start the path at 0,0 facing forward
 
-  // both tasks run until autonomous is ended or if a task has finished - in our
-  // example case the drive task is the controlling task - it syncrhonizes with the
-  // intake task via the global intakeRunNow and intakeReverse global booleans.
+  const ppPoint waypoints[] = {
+    {   0,    0 },
+    { 100,    0 },
+    { 150,  -20 },                    // round the corner to the right
+    { 170,  -70 }
+  };
+  ppPathCreate(samplePath, waypoints, sizeof(waypoints) / sizeof(waypoints[0]));
+  followPath(samplePath, 75);
 
+  pose_t pose = getPose();
+  std::cout << "Path done at x: " << pose.x << " y: " << pose.y << " theta: " << pose.theta << "\n";
+}
+
+// -------------------- precompiled trajectory sample -----------------------------------
+// Drives the sCurve trajectory from tools/paths.txt.  It was generated on the computer
+// by "make paths" and is just a table in the program, so there is nothing to compute
+// at startup.  RAMSETE (ramsete.cpp) keeps the robot on it using the odometry.
+
+void autoTrajectory() {
+  killTasks();
+  odomReset({sCurve[0].x, sCurve[0].y, sCurve[0].theta});   // we start on the first point
+  followTrajectory(sCurve, S_CURVE_POINTS);
+}
+
+// -------------------- cached trajectory sample ----------------------------------------
+// The same route as autoPursuit() but as a trajectory made on the brain.  It is generated
+// in initialize() by prepareTrajectories(): the first time it is saved to the SD card,
+// every boot after that it is read back from the card, which is much faster.
+
+#define CACHED_MAX_POINTS 1500          // 15 sec of trajectory
+static trajPoint cachedTraj[CACHED_MAX_POINTS];   // static - far too big for a stack
+static int cachedTrajCount = 0;
+
+void prepareTrajectories() {
+  const pathSample waypoints[] = {
+    {   0,    0 },
+    { 100,    0 },
+    { 150,  -20 },                    // round the corner to the right
+    { 170,  -70 }
+  };
+  const trajConstraints constraints = {60, 60, 70, WHEEL_BASE};   // cm/s, cm/s^2, cm/s, cm
+  cachedTrajCount = trajCacheGet(waypoints, sizeof(waypoints) / sizeof(waypoints[0]),
+                                 constraints, cachedTraj, CACHED_MAX_POINTS);
+}
+
+void autoCachedTrajectory() {
+  killTasks();
+  if(cachedTrajCount == 0) {
+    std::cout << "No cached trajectory, call prepareTrajectories() in initialize()\n";
+    return;
+  }
+  odomReset();                        // we start the path at 0,0 facing forward
+  followTrajectory(cachedTraj, cachedTrajCount);
+}
+
+// -------------------- planned route sample --------------------------------------------
+// Lets the planner (planner.cpp) find the way to a spot on the other side of the field
+// elements, then drives it as a trajectory.  Positions are field coordinates, so the
+// odometry starts at where the robot really is on the field.
+
+#define PLANNED_START_X 60.0            // cm from the field corner - CHANGE to the real
+#define PLANNED_START_Y 300.0           // start position of the robot
+#define PLANNED_MAX_SAMPLES 1000
+static pathSample plannedSamples[PLANNED_MAX_SAMPLES];
+static trajPoint plannedTraj[CACHED_MAX_POINTS];
+
+void autoPlanned() {
+  killTasks();
+  odomReset({PLANNED_START_X, PLANNED_START_Y, -3.14159 / 2});   // facing the back wall
+
+  std::uint32_t start = pros::millis();
+  pathSample waypoints[PLAN_MAX_WAYPOINTS];
+  int count = planRoute(PLANNED_START_X, PLANNED_START_Y, 300, 60, waypoints, PLAN_MAX_WAYPOINTS);
+  if(count == 0) {
+    std::cout << "No route found\n";
+    return;
+  }
+  int samples = pathFromWaypoints(waypoints, count, plannedSamples, PLANNED_MAX_SAMPLES);
+  const trajConstraints constraints = {60, 60, 70, WHEEL_BASE};
+  int points = trajGenerate(plannedSamples, samples, constraints, plannedTraj, CACHED_MAX_POINTS);
+  if(DEBUG) {
+    std::cout << "Route with " << count << " waypoints planned in " << pros::millis() - start << "ms\n";
+  }
+  followTrajectory(plannedTraj, points);
+}
+
+// -------------------- replay a recorded route -------------------------------------------
+// Drives the route recorded with recordStart() in opcontrol() (see recorder.cpp).  The
+// recording is a trajectory with a point every 10ms, RAMSETE follows it and corrects
+// for where the robot really is.  The odometry starts at the first recorded pose, so
+// put the robot where the recording started.
+
+static trajPoint replayTraj[RECORD_MAX_SAMPLES];  // static - far too big for a stack
+
+void autoReplay() {
+  killTasks();
+  int count = recordLoad("replay", replayTraj, RECORD_MAX_SAMPLES);
+  if(count == 0) {
+    std::cout << "No recording on the SD card\n";
+    return;
+  }
+  odomReset({replayTraj[0].x, replayTraj[0].y, replayTraj[0].theta});
+  followTrajectory(replayTraj, count);
 }
@@ -0,0 +1,134 @@
+// ------- autoscript.cpp ---------------------------------------------------------
+//
+// Use autoscript.cpp together with autoscript.hpp to run autonomous routines from the SD
+// card.  Write the routine in tools/autos/<name>.txt, compile it with "make autos" and
+// copy tools/bin/<name>.bin to the root of the SD card.
+//
+// scriptLoad() reads the file once at startup into the fixed buffer of its slot (one per
+// routine) and checks it, so running it later needs no file access and no memory
+// allocation.  scriptRun() then goes through the instructions one by one and calls the
+// same drivebase and intake functions the C++ routines use - a switch on the opcode byte
+// is all the "decoding" there is.
+
+#include "main.h"
+#include "globals.hpp"
+#include "drivebase.hpp"
+#include "intake.hpp"
+#include "colorsort.hpp"
+#include "triggers.hpp"
+#include "autoscript.hpp"
+
+struct scriptBuffer {
+  std::uint8_t code[SCRIPT_MAX_BYTES];
+  int length;                         // 0 = no script loaded
+};
+
+static scriptBuffer scripts[SCRIPT_SLOTS];
+
+// ------------------- load --------------------------------------------------------
+bool scriptLoad(scriptSlot_e slot, const char* name) {
+  std::uint8_t* code = scripts[slot].code;
+  scripts[slot].length = 0;
+  if(!pros::usd::is_installed()) {
+    return false;
+  }
+  char path[48];
+  snprintf(path, sizeof(path), "/usd/%s.bin", name);
+  FILE* file = fopen(path, "rb");
+  if(file == NULL) {
+    return false;
+  }
+  scriptHeader header;
+  bool ok = fread(&header, sizeof(header), 1, file) == 1 && header.magic == SCRIPT_MAGIC &&
+            header.version == SCRIPT_VERSION && header.length <= SCRIPT_MAX_BYTES &&
+            fread(code, 1, header.length, file) == header.length &&
+            scriptValidate(code, header.length);
+  fclose(file);
+  if(!ok) {
+    if(DEBUG) { std::cout << "Script " << path << " is not valid - ignored\n"; }
+    return false;
+  }
+  scripts[slot].length = header.length;
+  if(DEBUG) { std::cout << "Script " << path << " loaded, " << header.length << " bytes\n"; }
+  return true;
+}
+
+bool scriptLoaded(scriptSlot_e slot) {
+  return scripts[slot].length > 0;
+}
+
+// ------------------- conditions --------------------------------------------------
+static bool condition(std::uint8_t which) {
+  switch(which) {
+    case SCRIPT_ALWAYS:         return true;
+    case SCRIPT_INTAKE_FULL:    return intakeGetState() == INTAKE_HOLDING;
+    case SCRIPT_INTAKE_EMPTY:   return intakeObjectCount == 0;
+    case SCRIPT_INTAKE_JAMMED:  return intakeJammed;
+    case SCRIPT_ALLIANCE_RED:   return allianceColor == OBJECT_RED;
+    case SCRIPT_ALLIANCE_BLUE:  return allianceColor == OBJECT_BLUE;
+    default:                    return false;
+  }
+}
+
+// ------------------- run ---------------------------------------------------------
+// Blocking - returns when the script reached SCRIPT_END or its last instruction.
+// Triggers left over from an earlier routine are dropped first, and the ones this
+// script added without a motion after them are dropped at the end, so triggers never
+// fire in a routine they do not belong to.
+// The intake instructions need the intake task running (see autoTask()).
+
+void scriptRun(scriptSlot_e slot) {
+  const std::uint8_t* code = scripts[slot].code;
+  int codeLength = scripts[slot].length;
+  int pc = 0;                         // "program counter" - offset of the next instruction
+  triggersClear();
+  while(pc < codeLength) {
+    const std::uint8_t* op = &code[pc];
+    int next = pc + scriptOpSize(op[0]);
+    switch(op[0]) {
+      case SCRIPT_DRIVE:
+        driveForDistance(scriptInt16(&op[1]) / 10.0, op[3]);
+        break;
+
+      case SCRIPT_TURN:
+        pivotTurn(scriptInt16(&op[1]) / 10.0, op[3]);
+        break;
+
+      case SCRIPT_SWING: {
+        DriveMove move;
+        move.start(scriptInt16(&op[1]) / 10.0, scriptInt16(&op[3]) / 10.0, op[5]);
+        runDriveMove(move);
+        break;
+      }
+
+      case SCRIPT_INTAKE:
+        intakePost((intakeEvent_e)op[1]);
+        break;
+
+      case SCRIPT_WAIT:
+        pros::delay(scriptUint16(&op[1]));
+        break;
+
+      case SCRIPT_TRIGGER:
+        if(op[1] == SCRIPT_TRIGGER_DISTANCE) {
+          triggerAtDistance(scriptInt16(&op[2]) / 10.0, (intakeEvent_e)op[4]);
+        } else {
+          triggerAtHeading(scriptInt16(&op[2]) / 10.0, (intakeEvent_e)op[4]);
+        }
+        break;
+
+      case SCRIPT_BRANCH:
+        if(condition(op[1])) {
+          next = scriptUint16(&op[2]);
+        }
+        break;
+
+      case SCRIPT_END:
+      default:
+        next = codeLength;              // done
+        break;
+    }
+    pc = next;
+  }
+  triggersClear();
+}
@@ -0,0 +1,137 @@
+// ------- battery.cpp ---------------------------------------------------------
+//
+// Use battery.cpp together with battery.hpp to keep the drive the same from a full to
+// an empty battery.
+//
+// The readings: the brain measures the battery voltage and current every few ms, both
+// jump around with the motor load so we smooth them (exponential moving average).  The
+// scale for the drive voltages is BATTERY_NOMINAL_MV / voltage, limited so one bad
+// reading can not make the robot jump.
+//
+// The sag log: while the robot is enabled, every BATTERY_LOG_MS a voltage and current
+// pair goes into a ring buffer - when it is full the oldest pair is overwritten, so it
+// always holds the last BATTERY_LOG_SIZE samples, the match just played.
+// batterySaveLog() writes it to the SD card as a csv file for a spreadsheet.  We do not
+// wait for the file to see the sag: a least squares fit of a straight line through the
+// pairs in the log gives the voltage without load and how much the voltage drops per
+// amp.  The sums of the fit are kept up to date with a few additions per sample - the
+// pair which drops out of the ring is taken out of the sums again.
+
+#include "main.h"
+#include "globals.hpp"
+#include "battery.hpp"
+
+float batteryVoltage = 0;
+float batteryCurrent = 0;
+float batteryOpenVoltage = 0;
+float batteryResistance = 0;
+
+struct batterySample {
+  std::uint32_t time;                 // ms since the program started
+  std::int16_t voltage;               // mV
+  std::int16_t current;               // mA
+};
+
+static batterySample batteryLog[BATTERY_LOG_SIZE];
+static int logCount = 0;              // samples in the log, at most BATTERY_LOG_SIZE
+static int logNext = 0;               // where the next sample goes, the oldest when full
+
+// sums for the least squares fit, current in A and voltage in mV
+static double sumN = 0;
+static double sumI = 0;
+static double sumV = 0;
+static double sumII = 0;
+static double sumIV = 0;
+
+// ------------------- compensation ------------------------------------------------
+float batteryScale() {
+  if(batteryVoltage <= 0) {
+    return 1;                         // no reading yet
+  }
+  float scale = BATTERY_NOMINAL_MV / batteryVoltage;
+  return scale < BATTERY_MIN_SCALE ? BATTERY_MIN_SCALE :
+         scale > BATTERY_MAX_SCALE ? BATTERY_MAX_SCALE : scale;
+}
+
+// ------------------- sag fit -----------------------------------------------------
+// sign 1 adds a sample to the sums, -1 takes it out again
+static void fitSums(const batterySample &sample, int sign) {
+  double amps = sample.current / 1000.0;
+  sumN += sign;
+  sumI += sign * amps;
+  sumV += sign * sample.voltage;
+  sumII += sign * amps * amps;
+  sumIV += sign * amps * sample.voltage;
+}
+
+static void fitSag() {
+  double spread = sumN * sumII - sumI * sumI;
+  if(sumN > 1 && spread > 1e-6 * sumN * sumN) {   // the current has to vary for a fit
+    double slope = (sumN * sumIV - sumI * sumV) / spread;         // mV per A
+    batteryResistance = -slope;
+    batteryOpenVoltage = (sumV - slope * sumI) / sumN;
+  }
+}
+
+// ------------------- save the log ------------------------------------------------
+bool batterySaveLog() {
+  if(!pros::usd::is_installed() || logCount == 0) {
+    return false;
+  }
+  FILE* file = fopen(BATTERY_LOG_FILE, "w");
+  if(file == NULL) {
+    return false;
+  }
+  fprintf(file, "time ms,voltage mV,current mA\n");
+  int count = logCount;
+  int oldest = (count < BATTERY_LOG_SIZE) ? 0 : logNext;
+  for(int i = 0; i < count; i++) {
+    const batterySample &sample = batteryLog[(oldest + i) % BATTERY_LOG_SIZE];
+    fprintf(file, "%lu,%d,%d\n", (unsigned long)sample.time, sample.voltage, sample.current);
+  }
+  fprintf(file, "# fit: open voltage %.0f mV, resistance %.0f mOhm\n", batteryOpenVoltage,
+          batteryResistance);
+  fclose(file);
+  if(DEBUG) { std::cout << "Battery log saved, " << count << " samples\n"; }
+  return true;
+}
+
+// ----------------------- battery task -----------------------------------------------
+// Started in initialize() and never killed - the drive only reads batteryScale().
+
+void batteryTaskFnc(void* ignore) {
+    //the void* is there to provide a way to pass a
+    //generic value or structure to the task if needed
+    //pros needs this parameter in your function even if you don't use it
+    int loops = 0;
+    std::uint32_t now = pros::millis();   // time stamp in milli sec
+    while(true) {
+      std::int32_t voltage = pros::battery::get_voltage();
+      std::int32_t current = pros::battery::get_current();
+      if(voltage != PROS_ERR && current != PROS_ERR) {
+        if(batteryVoltage <= 0) {
+          batteryVoltage = voltage;       // first reading, nothing to smooth yet
+          batteryCurrent = current;
+        }
+        batteryVoltage += BATTERY_FILTER * (voltage - batteryVoltage);
+        batteryCurrent += BATTERY_FILTER * (current - batteryCurrent);
+      }
+
+      if(++loops % (BATTERY_LOG_MS / BATTERY_LOOP_MS) == 0 && batteryVoltage > 0 &&
+         !pros::competition::is_disabled()) {
+        batterySample &sample = batteryLog[logNext];
+        if(logCount == BATTERY_LOG_SIZE) {
+          fitSums(sample, -1);            // the oldest sample drops out
+        } else {
+          logCount++;
+        }
+        sample.time = pros::millis();
+        sample.voltage = batteryVoltage;
+        sample.current = batteryCurrent;
+        fitSums(sample, 1);
+        fitSag();
+        logNext = (logNext + 1) % BATTERY_LOG_SIZE;
+      }
+      pros::Task::delay_until(&now, BATTERY_LOOP_MS);
+    }
+}
@@ -0,0 +1,243 @@
+// ------- characterize.cpp ---------------------------------------------------------
+//
+// Use characterize.cpp together with characterize.hpp to measure the drivebase instead
+// of relying on the nominal values in drivebase.hpp and feedforward.hpp.
+//
+// The routine runs four kinds of test on left_wheel / right_wheel:
+//  - quasistatic: the voltage ramps up slowly, acceleration stays ~0 so the samples
+//    show the relation between voltage and velocity (kS and kV)
+//  - dynamic: a voltage step, the robot accelerates hard which shows kA
+//  - both are done forwards and backwards
+//  - spin: turn in place, the odometers tell how far we turned which gives the
+//    effective track width (wheel scrub makes it differ from the measured WHEEL_BASE)
+//
+// All samples are recorded with the telemetry recorder and saved to the SD card, the
+// constants are fitted on the brain with least squares:
+//    voltage = kS * sign(velocity) + kV * velocity + kA * acceleration
+//
+// The test voltages go through driveSetVoltage() like every other drive voltage, so they
+// are compensated for the battery (battery.cpp) and the constants hold for a battery at
+// BATTERY_NOMINAL_MV - a characterization on a half empty battery gives the same numbers.
+//
+// Make sure the robot has at least CHAR_MAX_DISTANCE cm of free space in front of it.
+
+#include "main.h"
+#include "globals.hpp"
+#include "drivebase.hpp"
+#include "traction.hpp"
+#include "telemetry.hpp"
+#include "characterize.hpp"
+#include "battery.hpp"
+
+// ------------------- least squares with three unknowns -----------------------------
+// We never keep the samples for the fit, we only add them into the normal equations
+// (A^T A) x = A^T b, which is solved at the end.
+
+struct leastSquares3 {
+  double ata[3][3];
+  double atb[3];
+  int count;
+};
+
+static void lsqReset(leastSquares3 &lsq) {
+  for(int r = 0; r < 3; r++) {
+    for(int c = 0; c < 3; c++) {
+      lsq.ata[r][c] = 0;
+    }
+    lsq.atb[r] = 0;
+  }
+  lsq.count = 0;
+}
+
+static void lsqAdd(leastSquares3 &lsq, double x0, double x1, double x2, double y) {
+  double x[3] = {x0, x1, x2};
+  for(int r = 0; r < 3; r++) {
+    for(int c = 0; c < 3; c++) {
+      lsq.ata[r][c] += x[r] * x[c];
+    }
+    lsq.atb[r] += x[r] * y;
+  }
+  lsq.count++;
+}
+
+// Gaussian elimination with partial pivoting, returns false if there is no solution
+static bool lsqSolve(leastSquares3 &lsq, double result[3]) {
+  double m[3][4];
+  for(int r = 0; r < 3; r++) {
+    for(int c = 0; c < 3; c++) {
+      m[r][c] = lsq.ata[r][c];
+    }
+    m[r][3] = lsq.atb[r];
+  }
+  for(int col = 0; col < 3; col++) {
+    int pivot = col;
+    for(int r = col + 1; r < 3; r++) {
+      if(fabs(m[r][col]) > fabs(m[pivot][col])) {
+        pivot = r;
+      }
+    }
+    if(fabs(m[pivot][col]) < 1e-9) {
+      return false;
+    }
+    for(int c = 0; c < 4; c++) {
+      double t = m[col][c];
+      m[col][c] = m[pivot][c];
+      m[pivot][c] = t;
+    }
+    for(int r = 0; r < 3; r++) {
+      if(r != col) {
+        double factor = m[r][col] / m[col][col];
+        for(int c = col; c < 4; c++) {
+          m[r][c] -= factor * m[col][c];
+        }
+      }
+    }
+  }
+  for(int r = 0; r < 3; r++) {
+    result[r] = m[r][3] / m[r][r];
+  }
+  return true;
+}
+
+// ------------------- test state ----------------------------------------------------
+static leastSquares3 leftFit;
+static leastSquares3 rightFit;
+static float motorTravel = 0;       // cm the motors turned during straight tests
+static float odomTravel = 0;        // cm the odometers measured during straight tests
+
+static float motorCm(pros::Motor &motor) {
+  return (motor.get_position() / 360) * (3.14 * WHEEL_DIAM);
+}
+
+static float odomCm(pros::Rotation &odom) {
+  return (odom.get_position() / 36000.0) * (3.14 * ODOM_WHEEL_DIAM);
+}
+
+// ------------------- run one test --------------------------------------------------
+// leftSign / rightSign give the direction of each side, ramp selects a quasistatic
+// (true) or a step test at stepVoltage (false).  fit adds the samples to the feedforward
+// fit.  travel is filled with the cm both sides turned as measured by the motors [0,1]
+// and by the odometers [2,3] so the caller can work out diameter and track width.
+
+static void runTest(int testId, float leftSign, float rightSign, bool ramp, float stepVoltage,
+                    std::uint32_t duration, bool fit, float travel[4]) {
+  left_wheel.tare_position();
+  right_wheel.tare_position();
+  float leftOdomStart = odomCm(left_odom);
+  float rightOdomStart = odomCm(right_odom);
+
+  float lastLeftVel = 0;
+  float lastRightVel = 0;
+  std::uint32_t start = pros::millis();
+  std::uint32_t now = start;
+  while(pros::millis() - start < duration) {
+    float t = (pros::millis() - start) / 1000.0;
+    float voltage = ramp ? fminf(CHAR_RAMP_RATE * t, CHAR_RAMP_MAX) : stepVoltage;
+    driveSetVoltage(leftSign * voltage, rightSign * voltage);   // fit at nominal battery
+
+    pros::Task::delay_until(&now, DRIVE_LOOP_MS);
+
+    // motor velocity in RPM to wheel velocity in cm/s
+    float leftVel = (left_wheel.get_actual_velocity() * 3.14 * WHEEL_DIAM) / 60;
+    float rightVel = (right_wheel.get_actual_velocity() * 3.14 * WHEEL_DIAM) / 60;
+    float leftAcc = (leftVel - lastLeftVel) / (DRIVE_LOOP_MS / 1000.0);
+    float rightAcc = (rightVel - lastRightVel) / (DRIVE_LOOP_MS / 1000.0);
+    lastLeftVel = leftVel;
+    lastRightVel = rightVel;
+
+    float sample[8] = {(float)testId, voltage, leftVel, rightVel, leftAcc, rightAcc,
+                       odomCm(left_odom) - leftOdomStart, odomCm(right_odom) - rightOdomStart};
+    telemetryRecord(sample, 8);
+
+    if(fit && fabsf(leftVel) > CHAR_MIN_VELOCITY) {
+      lsqAdd(leftFit, leftVel > 0 ? 1 : -1, leftVel, leftAcc, leftSign * voltage);
+    }
+    if(fit && fabsf(rightVel) > CHAR_MIN_VELOCITY) {
+      lsqAdd(rightFit, rightVel > 0 ? 1 : -1, rightVel, rightAcc, rightSign * voltage);
+    }
+
+    if(fabsf(motorCm(left_wheel)) > CHAR_MAX_DISTANCE) {
+      break;                          // running out of space
+    }
+  }
+
+  left_wheel.move_voltage(0);
+  right_wheel.move_voltage(0);
+  travel[0] = motorCm(left_wheel);
+  travel[1] = motorCm(right_wheel);
+  travel[2] = odomCm(left_odom) - leftOdomStart;
+  travel[3] = odomCm(right_odom) - rightOdomStart;
+  pros::delay(CHAR_PAUSE);
+}
+
+// ------------------- characterize drive --------------------------------------------
+charResult characterizeDrive() {
+  charResult result;
+  result.left = leftFF;
+  result.right = rightFF;
+  result.trackWidth = WHEEL_BASE;
+  result.wheelDiam = WHEEL_DIAM;
+  result.valid = false;
+
+  lsqReset(leftFit);
+  lsqReset(rightFit);
+  motorTravel = 0;
+  odomTravel = 0;
+  telemetryStart("characterize", "test,voltage,leftVel,rightVel,leftAcc,rightAcc,leftOdom,rightOdom");
+
+  float travel[4];
+  std::uint32_t rampTime = (1000 * CHAR_RAMP_MAX) / CHAR_RAMP_RATE;
+
+  // straight tests - forward and back again so we end up near the start
+  if(DEBUG) { std::cout << "Characterize: quasistatic tests\n"; }
+  runTest(1, 1, 1, true, 0, rampTime, true, travel);
+  motorTravel += fabsf(travel[0]) + fabsf(travel[1]);
+  odomTravel += fabsf(travel[2]) + fabsf(travel[3]);
+  runTest(2, -1, -1, true, 0, rampTime, true, travel);
+  motorTravel += fabsf(travel[0]) + fabsf(travel[1]);
+  odomTravel += fabsf(travel[2]) + fabsf(travel[3]);
+
+  if(DEBUG) { std::cout << "Characterize: dynamic tests\n"; }
+  runTest(3, 1, 1, false, CHAR_STEP_VOLTAGE, CHAR_STEP_TIME, true, travel);
+  runTest(4, -1, -1, false, CHAR_STEP_VOLTAGE, CHAR_STEP_TIME, true, travel);
+
+  // spin test - the odometer wheels are WHEEL_BASE apart, so the angle we turned is
+  // (left - right) / WHEEL_BASE.  The drive wheels needed (left - right) motor travel
+  // for that angle, which makes their effective track width.
+  if(DEBUG) { std::cout << "Characterize: track width test\n"; }
+  runTest(5, 1, -1, false, CHAR_SPIN_VOLTAGE, CHAR_SPIN_TIME, false, travel);
+  float angle = (travel[2] - travel[3]) / WHEEL_BASE;            // radians
+  if(fabsf(angle) > 0.5) {
+    result.trackWidth = (travel[0] - travel[1]) / angle;
+  }
+
+  if(motorTravel > 0) {
+    result.wheelDiam = WHEEL_DIAM * (odomTravel / motorTravel);
+  }
+
+  double left[3];
+  double right[3];
+  if(lsqSolve(leftFit, left) && lsqSolve(rightFit, right)) {
+    result.left = {(float)left[0], (float)left[1], (float)left[2]};
+    result.right = {(float)right[0], (float)right[1], (float)right[2]};
+    result.valid = result.left.kV > 0 && result.right.kV > 0;
+  }
+
+  telemetrySave();
+
+  if(result.valid) {
+    leftFF = result.left;             // use the new constants right away
+    rightFF = result.right;
+  }
+
+  // print the results ready to be copied into feedforward.hpp and drivebase.hpp
+  std::cout << "Characterize results (valid " << result.valid << ", samples left "
+            << leftFit.count << " right " << rightFit.count << ", battery " << batteryVoltage
+            << " mV, sag " << batteryResistance << " mV/A)\n";
+  printf("#define FF_LEFT_KS %.1f\n#define FF_LEFT_KV %.2f\n#define FF_LEFT_KA %.2f\n",
+         result.left.kS, result.left.kV, result.left.kA);
+  printf("#define FF_RIGHT_KS %.1f\n#define FF_RIGHT_KV %.2f\n#define FF_RIGHT_KA %.2f\n",
+         result.right.kS, result.right.kV, result.right.kA);
+  printf("#define WHEEL_DIAM %.2f\n#define WHEEL_BASE %.2f\n", result.wheelDiam, result.trackWidth);
+  return result;
+}
@@ -0,0 +1,105 @@
+// ------- colorsort.cpp ---------------------------------------------------------
+//
+// Use colorsort.cpp together with colorsort.hpp to see game objects coming into the
+// intake with the optical sensor (intake_optical) and to sort them by color.
+//
+// The pipeline, every OPTICAL_SAMPLE_MS:
+//  1. read proximity and hue
+//  2. edge detection on the proximity with two thresholds (hysteresis) - an object
+//     enters above OPTICAL_PROX_ENTER and leaves below OPTICAL_PROX_EXIT, so a value
+//     around a single threshold does not flip back and forth
+//  3. debounce - the new state has to be seen OPTICAL_DEBOUNCE samples in a row
+//  4. when an object entered, its color is the average hue of the debounce samples,
+//     and we post an event to the intake task (intake.cpp) which keeps or ejects it
+//
+// The whole pipeline is a few comparisons, the reaction time is set by how fast the
+// sensor delivers new data - about 10 to 20ms from the object reaching the sensor.
+
+#include "main.h"
+#include "globals.hpp"
+#include "intake.hpp"
+#include "tasks.hpp"
+#include "colorsort.hpp"
+
+objectColor_e allianceColor = OBJECT_UNKNOWN;  // set before the match - see colorsort.hpp
+int objectsSeen = 0;
+objectColor_e lastObjectColor = OBJECT_UNKNOWN;
+
+// ------------------- hue to color ------------------------------------------------
+objectColor_e hueToColor(double hue) {
+  if(hue >= HUE_RED_LOW || hue <= HUE_RED_HIGH) {
+    return OBJECT_RED;
+  }
+  if(hue >= HUE_BLUE_LOW && hue <= HUE_BLUE_HIGH) {
+    return OBJECT_BLUE;
+  }
+  return OBJECT_UNKNOWN;
+}
+
+// ------------------- object entered ----------------------------------------------
+// Tell the intake task - only when it is running, otherwise the events would pile up
+static void objectEntered(objectColor_e color) {
+  objectsSeen++;
+  lastObjectColor = color;
+  if(DEBUG) { std::cout << "Object " << objectsSeen << " color " << color << "\n";}
+  if(!intake) {
+    return;
+  }
+  if(allianceColor != OBJECT_UNKNOWN && color != OBJECT_UNKNOWN && color != allianceColor) {
+    intakePost(INTAKE_EV_OBJECT_WRONG);
+  } else {
+    intakePost(INTAKE_EV_OBJECT_OURS);
+  }
+}
+
+// ----------------------- optical sensor task ---------------------------------------
+// Started in initialize() and never killed, like the velocity task - it only reads the
+// sensor and posts events.
+
+void colorSortTaskFnc(void* ignore) {
+    //the void* is there to provide a way to pass a
+    //generic value or structure to the task if needed
+    //pros needs this parameter in your function even if you don't use it
+    intake_optical.disable_gesture();         // gesture mode slows down the color data
+    intake_optical.set_led_pwm(OPTICAL_LED_PWM);
+
+    bool present = false;                     // debounced - object in front of the sensor
+    int changeCount = 0;                      // samples in a row which disagree
+    float hueX = 0;                           // sum of hue as unit vectors, so red
+    float hueY = 0;                           // around 0/360 averages properly
+
+    std::uint32_t now = pros::millis();       // time stamp in milli sec
+    while(true) {
+      std::int32_t proximity = intake_optical.get_proximity();
+      double hue = intake_optical.get_hue();
+
+      if(proximity != PROS_ERR) {
+        // hysteresis - which way would the raw sample flip the state?
+        bool change = present ? (proximity < OPTICAL_PROX_EXIT) : (proximity > OPTICAL_PROX_ENTER);
+        if(change) {
+          if(changeCount == 0) {
+            hueX = 0;
+            hueY = 0;
+          }
+          changeCount++;
+          hueX += cos(hue * 3.14159 / 180);
+          hueY += sin(hue * 3.14159 / 180);
+        } else {
+          changeCount = 0;
+        }
+
+        if(changeCount >= OPTICAL_DEBOUNCE) {
+          present = !present;
+          changeCount = 0;
+          if(present) {
+            double averageHue = atan2(hueY, hueX) * 180 / 3.14159;
+            if(averageHue < 0) {
+              averageHue += 360;
+            }
+            objectEntered(hueToColor(averageHue));
+          }
+        }
+      }
+      pros::Task::delay_until(&now, OPTICAL_SAMPLE_MS);
+    }
+}
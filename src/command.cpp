@@ -0,0 +1,483 @@
+// ------- command.cpp ---------------------------------------------------------
+//
+// Use command.cpp together with command.hpp to write autonomous routines as a tree of
+// commands instead of blocking calls and hand made tasks.
+//
+// The blocking functions (driveForDistance() and friends) keep the calling task busy
+// until the robot stopped, so running the intake at the same time needed a second task
+// and global flags.  The drive controllers underneath (DriveMove, PathFollower,
+// TrajectoryFollower) already work one step at a time, so here they are wrapped in
+// commands and one scheduler loop steps all running commands every CMD_LOOP_MS.
+//
+// Memory: commands are placed in one static pool with a "bump" allocator - every new
+// command simply goes behind the last one.  Nothing is ever freed on its own, the whole
+// pool is emptied with commandPoolReset() before the next routine is built.  So there
+// are no heap allocations and no fragmentation during a match.
+
+#include "main.h"
+#include "globals.hpp"
+#include "drivebase.hpp"
+#include "ramsete.hpp"
+#include "triggers.hpp"
+#include "command.hpp"
+
+// ------------------- pool ----------------------------------------------------------
+alignas(8) static std::uint8_t pool[CMD_POOL_BYTES];
+static std::size_t poolUsed = 0;
+
+void* commandAlloc(std::size_t size) {
+  size = (size + 7) & ~(std::size_t)7;        // keep every command 8 byte aligned
+  if(poolUsed + size > CMD_POOL_BYTES) {
+    if(DEBUG) { std::cout << "Command pool full - increase CMD_POOL_BYTES\n"; }
+    return nullptr;
+  }
+  void* memory = &pool[poolUsed];
+  poolUsed += size;
+  return memory;
+}
+
+void commandPoolReset() {
+  commandCancelAll();
+  poolUsed = 0;
+}
+
+int commandPoolUsed() {
+  return poolUsed;
+}
+
+// ------------------- groups ----------------------------------------------------------
+// A group keeps its commands in a fixed array.  Its requirements are those of all its
+// commands together, so the scheduler treats the group as one command.
+
+class CommandGroup : public Command {
+  public:
+    CommandGroup(std::initializer_list<Command*> list) {
+      for(Command* command : list) {
+        if(command == nullptr) {
+          continue;                           // pool was full, already reported
+        }
+        if(count >= CMD_GROUP_MAX) {
+          if(DEBUG) { std::cout << "Command group full - increase CMD_GROUP_MAX\n"; }
+          break;
+        }
+        commands[count++] = command;
+        requirements |= command->requirements;
+      }
+    }
+
+  protected:
+    Command* commands[CMD_GROUP_MAX];
+    int count = 0;
+};
+
+// one after the other
+class SequentialGroup : public CommandGroup {
+  public:
+    using CommandGroup::CommandGroup;
+
+    void initialize() override {
+      current = 0;
+      if(count > 0) {
+        commands[0]->initialize();
+      }
+    }
+
+    void execute() override {
+      // an instant command finishes right away, so we may go through several at once
+      while(current < count) {
+        commands[current]->execute();
+        if(!commands[current]->isFinished()) {
+          return;
+        }
+        commands[current]->end(false);
+        current++;
+        if(current < count) {
+          commands[current]->initialize();
+        }
+      }
+    }
+
+    bool isFinished() override { return current >= count; }
+
+    void end(bool interrupted) override {
+      if(interrupted && current < count) {
+        commands[current]->end(true);
+      }
+    }
+
+  private:
+    int current = 0;
+};
+
+// all at once - how it ends depends on the kind of group
+enum parallelKind_e { PARALLEL_ALL, PARALLEL_RACE, PARALLEL_DEADLINE };
+
+class ParallelGroup : public CommandGroup {
+  public:
+    ParallelGroup(std::initializer_list<Command*> list, parallelKind_e kind)
+      : CommandGroup(list), kind(kind) {
+      // two commands at the same time can not drive the same subsystem
+      std::uint32_t used = 0;
+      for(int i = 0; i < count; i++) {
+        if(DEBUG && (used & commands[i]->requirements)) {
+          std::cout << "Parallel commands use the same subsystem\n";
+        }
+        used |= commands[i]->requirements;
+      }
+    }
+
+    void initialize() override {
+      finished = false;
+      for(int i = 0; i < count; i++) {
+        running[i] = true;
+        commands[i]->initialize();
+      }
+    }
+
+    void execute() override {
+      bool anyRunning = false;
+      for(int i = 0; i < count; i++) {
+        if(!running[i]) {
+          continue;
+        }
+        commands[i]->execute();
+        if(commands[i]->isFinished()) {
+          commands[i]->end(false);
+          running[i] = false;
+          if(kind == PARALLEL_RACE || (kind == PARALLEL_DEADLINE && i == 0)) {
+            finished = true;
+          }
+        } else {
+          anyRunning = true;
+        }
+      }
+      if(!anyRunning) {
+        finished = true;
+      }
+      if(finished) {
+        stopRunning();                        // race / deadline over - stop the rest
+      }
+    }
+
+    bool isFinished() override { return finished || count == 0; }
+
+    void end(bool interrupted) override {
+      if(interrupted) {
+        stopRunning();
+      }
+    }
+
+  private:
+    void stopRunning() {
+      for(int i = 0; i < count; i++) {
+        if(running[i]) {
+          commands[i]->end(true);
+          running[i] = false;
+        }
+      }
+    }
+
+    parallelKind_e kind;
+    bool running[CMD_GROUP_MAX];
+    bool finished = false;
+};
+
+Command* cmdSequence(std::initializer_list<Command*> commands) {
+  return cmdNew<SequentialGroup>(commands);
+}
+
+Command* cmdParallel(std::initializer_list<Command*> commands) {
+  return cmdNew<ParallelGroup>(commands, PARALLEL_ALL);
+}
+
+Command* cmdRace(std::initializer_list<Command*> commands) {
+  return cmdNew<ParallelGroup>(commands, PARALLEL_RACE);
+}
+
+Command* cmdDeadline(std::initializer_list<Command*> commands) {
+  return cmdNew<ParallelGroup>(commands, PARALLEL_DEADLINE);
+}
+
+// ------------------- drive commands --------------------------------------------------
+// The drive controllers, one step per tick.  Position triggers (triggers.cpp) work in
+// commands just like in the blocking functions.
+
+class DriveCommand : public Command {
+  public:
+    DriveCommand(float leftDistance, float rightDistance, int speed)
+      : leftDistance(leftDistance), rightDistance(rightDistance), speed(speed) {
+      requirements = REQ_DRIVE;
+    }
+    void initialize() override {
+      move.start(leftDistance, rightDistance, speed);
+      triggersBegin();
+    }
+    void execute() override {
+      finished = move.step();
+      triggersCheck(move.getTravelled());
+    }
+    bool isFinished() override { return finished; }
+    void end(bool interrupted) override {
+      if(interrupted) {
+        move.stop();
+      }
+      triggersEnd();
+      finished = false;
+    }
+
+  private:
+    DriveMove move;
+    float leftDistance;
+    float rightDistance;
+    int speed;
+    bool finished = false;
+};
+
+class PathCommand : public Command {
+  public:
+    PathCommand(const ppPath* path, int speed, bool reverse) : path(path), speed(speed), reverse(reverse) {
+      requirements = REQ_DRIVE;
+    }
+    void initialize() override {
+      follower.start(*path, speed, reverse);
+      triggersBegin();
+    }
+    void execute() override {
+      finished = follower.step();
+      triggersCheck(follower.getTravelled());
+    }
+    bool isFinished() override { return finished; }
+    void end(bool interrupted) override {
+      if(interrupted) {
+        follower.stop();
+      }
+      triggersEnd();
+      finished = false;
+    }
+
+  private:
+    PathFollower follower;
+    const ppPath* path;
+    int speed;
+    bool reverse;
+    bool finished = false;
+};
+
+class TrajectoryCommand : public Command {
+  public:
+    TrajectoryCommand(const trajPoint* trajectory, int count) : trajectory(trajectory), count(count) {
+      requirements = REQ_DRIVE;
+    }
+    void initialize() override {
+      follower.start(trajectory, count);
+      triggersBegin();
+    }
+    void execute() override {
+      finished = follower.step();
+      triggersCheck(follower.getTravelled());
+    }
+    bool isFinished() override { return finished; }
+    void end(bool interrupted) override {
+      if(interrupted) {
+        follower.stop();
+      }
+      triggersEnd();
+      finished = false;
+    }
+
+  private:
+    TrajectoryFollower follower;
+    const trajPoint* trajectory;
+    int count;
+    bool finished = false;
+};
+
+Command* cmdDrive(float distance, int speed) {
+  return cmdNew<DriveCommand>(distance, distance, speed);
+}
+
+Command* cmdDriveSides(float leftDistance, float rightDistance, int speed) {
+  return cmdNew<DriveCommand>(leftDistance, rightDistance, speed);
+}
+
+Command* cmdTurn(float angle, int speed) {
+  // the same as pivotTurn() - both wheels drive the turning circle in opposite direction
+  float distance = pivotDistance(angle);
+  return cmdNew<DriveCommand>(distance, -distance, speed);
+}
+
+Command* cmdPath(const ppPath &path, int speed, bool reverse) {
+  return cmdNew<PathCommand>(&path, speed, reverse);
+}
+
+Command* cmdTrajectory(const trajPoint* trajectory, int count) {
+  return cmdNew<TrajectoryCommand>(trajectory, count);
+}
+
+// ------------------- intake commands -------------------------------------------------
+// The intake task (intake.cpp) runs the intake, these commands only post its events.
+
+class IntakeCommand : public Command {
+  public:
+    explicit IntakeCommand(intakeEvent_e event) : event(event) {
+      requirements = REQ_INTAKE;
+    }
+    void initialize() override { intakePost(event); }
+
+  private:
+    intakeEvent_e event;
+};
+
+// runs until it is ended by its group (deadline or race) or cancelled
+class IntakeRunCommand : public Command {
+  public:
+    IntakeRunCommand() {
+      requirements = REQ_INTAKE;
+    }
+    void initialize() override { intakePost(INTAKE_EV_INTAKE); }
+    bool isFinished() override { return false; }
+    void end(bool interrupted) override { intakePost(INTAKE_EV_STOP); }
+};
+
+Command* cmdIntake(intakeEvent_e event) {
+  return cmdNew<IntakeCommand>(event);
+}
+
+Command* cmdIntakeRun() {
+  return cmdNew<IntakeRunCommand>();
+}
+
+// ------------------- helper commands -------------------------------------------------
+class WaitCommand : public Command {
+  public:
+    explicit WaitCommand(std::uint32_t ms) : ms(ms) {}
+    void initialize() override { startTime = pros::millis(); }
+    bool isFinished() override { return pros::millis() - startTime >= ms; }
+
+  private:
+    std::uint32_t ms;
+    std::uint32_t startTime = 0;
+};
+
+class WaitUntilCommand : public Command {
+  public:
+    explicit WaitUntilCommand(bool (*condition)()) : condition(condition) {}
+    bool isFinished() override { return condition(); }
+
+  private:
+    bool (*condition)();
+};
+
+class RunCommand : public Command {
+  public:
+    RunCommand(void (*callback)(void*), void* arg) : callback(callback), arg(arg) {}
+    void initialize() override { callback(arg); }
+
+  private:
+    void (*callback)(void*);
+    void* arg;
+};
+
+static void printText(void* text) {
+  std::cout << (const char*)text << "\n";
+}
+
+Command* cmdWait(std::uint32_t ms) {
+  return cmdNew<WaitCommand>(ms);
+}
+
+Command* cmdWaitUntil(bool (*condition)()) {
+  return cmdNew<WaitUntilCommand>(condition);
+}
+
+Command* cmdRun(void (*callback)(void* arg), void* arg) {
+  return cmdNew<RunCommand>(callback, arg);
+}
+
+Command* cmdPrint(const char* text) {
+  return cmdNew<RunCommand>(printText, (void*)text);
+}
+
+// ------------------- scheduler -------------------------------------------------------
+// The commands started with commandSchedule(), each one usually the root of a tree.
+// The scheduler runs in the task which calls commandTick() / commandRun(), normally
+// the autonomous task itself.
+
+static Command* scheduled[CMD_MAX_SCHEDULED];
+
+static int findScheduled(Command* command) {
+  for(int i = 0; i < CMD_MAX_SCHEDULED; i++) {
+    if(scheduled[i] == command) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void commandSchedule(Command* command) {
+  if(command == nullptr || findScheduled(command) >= 0) {
+    return;
+  }
+  // whoever uses one of our subsystems has to stop
+  for(int i = 0; i < CMD_MAX_SCHEDULED; i++) {
+    if(scheduled[i] != nullptr && (scheduled[i]->requirements & command->requirements)) {
+      scheduled[i]->end(true);
+      scheduled[i] = nullptr;
+    }
+  }
+  int slot = findScheduled(nullptr);
+  if(slot < 0) {
+    if(DEBUG) { std::cout << "Scheduler full - increase CMD_MAX_SCHEDULED\n"; }
+    return;
+  }
+  scheduled[slot] = command;
+  command->initialize();
+}
+
+void commandCancel(Command* command) {
+  int slot = findScheduled(command);
+  if(command != nullptr && slot >= 0) {
+    command->end(true);
+    scheduled[slot] = nullptr;
+  }
+}
+
+void commandCancelAll() {
+  for(int i = 0; i < CMD_MAX_SCHEDULED; i++) {
+    commandCancel(scheduled[i]);
+  }
+}
+
+bool commandIsScheduled(Command* command) {
+  return command != nullptr && findScheduled(command) >= 0;
+}
+
+void commandTick() {
+  for(int i = 0; i < CMD_MAX_SCHEDULED; i++) {
+    Command* command = scheduled[i];
+    if(command == nullptr) {
+      continue;
+    }
+    command->execute();
+    if(command->isFinished()) {
+      command->end(false);
+      scheduled[i] = nullptr;
+    }
+  }
+}
+
+void commandRun(Command* command) {
+  commandSchedule(command);
+  std::uint32_t now = pros::millis();
+  while(true) {
+    commandTick();
+    bool anyScheduled = false;
+    for(Command* running : scheduled) {
+      anyScheduled = anyScheduled || running != nullptr;
+    }
+    if(!anyScheduled) {
+      break;
+    }
+    pros::Task::delay_until(&now, CMD_LOOP_MS);
+  }
+}
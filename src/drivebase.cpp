@@ -12,6 +12,178 @@
 #include "portdef.hpp"
 #include "drivebase.hpp"
 #include "tasks.hpp"
+#include "intake.hpp"
+#include "triggers.hpp"
+#include "traction.hpp"
+#include "feedforward.hpp"
+#include "motorhealth.hpp"
+#include "battery.hpp"
+#include "power.hpp"
+
+// ------------------- feedback PID gains ---------------------------------------------
+// The feedforward does most of the work, the PID (pid.hpp) only corrects the difference
+// between where the profile says we should be and where the wheel is.  The gains are
+// tuned at a few speeds and interpolated for the speed asked for.
+// Gains are in mV per degree of encoder error.
+
+static const pidSchedule<float> driveSchedule[] = {
+  // speed RPM    kP     kI     kD
+  {   25,      { 20.0,  10.0,  0.6 } },
+  {   65,      { 16.0,   8.0,  0.9 } },
+  {  100,      { 12.0,   5.0,  1.2 } }
+};
+
+static const pidSchedule<float> turnSchedule[] = {
+  // speed RPM    kP     kI     kD
+  {   25,      { 24.0,  12.0,  0.5 } },
+  {   65,      { 18.0,  10.0,  0.8 } },
+  {  100,      { 14.0,   6.0,  1.0 } }
+};
+
+// unit conversions between cm on the field and encoder degrees of the drive wheels
+static float cmToDegrees(float cm) {
+  return (cm / (3.14 * WHEEL_DIAM)) * 360;
+}
+
+static float degreesToCm(float degrees) {
+  return (degrees / 360) * (3.14 * WHEEL_DIAM);
+}
+
+// ------------------- drive voltage -------------------------------------------------
+// The one place drive voltages go to the motors.  The voltages are meant for a battery at
+// BATTERY_NOMINAL_MV, the scale makes up for a fuller or sagging one (battery.cpp).
+// The power manager (power.cpp) sees them here for the current budget of the next tick.
+
+void driveSetVoltage(float leftVoltage, float rightVoltage) {
+  float scale = batteryScale();
+  leftVoltage = fmaxf(-FF_MAX_VOLTAGE, fminf(FF_MAX_VOLTAGE, leftVoltage * scale));
+  rightVoltage = fmaxf(-FF_MAX_VOLTAGE, fminf(FF_MAX_VOLTAGE, rightVoltage * scale));
+  left_wheel.move_voltage(leftVoltage);
+  right_wheel.move_voltage(rightVoltage);
+  powerDriveCommand(leftVoltage, rightVoltage);
+}
+
+// ------------------- drive move ----------------------------------------------------
+// See drivebase.hpp - used by driveForDistance(), pivotTurn() and anything which needs
+// to run the drivebase while doing other work in the same loop.
+
+DriveMove::DriveMove()
+  : leftPID(DRIVE_LOOP_MS / 1000.0), rightPID(DRIVE_LOOP_MS / 1000.0), done(true) {
+}
+
+void DriveMove::start(float leftDistance, float rightDistance, int speed) {
+  left_wheel.tare_position();       // ensure encoders are reset before
+  right_wheel.tare_position();      // movement.
+  tractionReset();                  // new baseline for slip detection
+
+  // one profile for the side which travels furthest, the other side is scaled
+  float longest = fmaxf(fabsf(leftDistance), fabsf(rightDistance));
+  leftScale = (longest > 0) ? leftDistance / longest : 0;
+  rightScale = (longest > 0) ? rightDistance / longest : 0;
+  leftTarget = cmToDegrees(leftDistance);
+  rightTarget = cmToDegrees(rightDistance);
+
+  // speed in RPM to wheel speed in cm/s, the same as the timing model (drivemodel.cpp),
+  // slower when the motors get hot (motorhealth.cpp)
+  profile = profileCreate(longest, driveMaxVelocity(speed) * healthDriveCap(), DRIVE_MAX_ACCEL);
+  profileTime = 0;
+
+  // a pivot turn has the wheels going in opposite directions
+  bool turn = (leftDistance * rightDistance) < 0;
+  const pidSchedule<float>* schedule = turn ? turnSchedule : driveSchedule;
+  int count = turn ? sizeof(turnSchedule) / sizeof(turnSchedule[0])
+                   : sizeof(driveSchedule) / sizeof(driveSchedule[0]);
+  PID<float>* pids[2] = {&leftPID, &rightPID};
+  for(PID<float>* pid : pids) {
+    pid->setSchedule(schedule, count);
+    pid->scheduleFor(speed);
+    pid->setIntegralLimit(DRIVE_INTEGRAL_LIMIT);
+    pid->setSlewLimit(DRIVE_SLEW_LIMIT);
+    pid->reset(0);
+  }
+
+  // safety timeout - twice the time the profile should take + 1 sec
+  timeout = pros::millis() + 1000 + 2000 * profileDuration(profile);
+  settled = 0;
+  done = false;
+}
+
+bool DriveMove::step() {
+  if(done) {
+    return true;
+  }
+  // while the wheels slip the profile advances slower (see traction.cpp)
+  tractionUpdate();
+  float timeScale = tractionTimeScale();
+  profileTime += timeScale * DRIVE_LOOP_MS / 1000.0;
+  profilePoint point = profileSample(profile, profileTime);
+  float velocity = point.velocity * timeScale;
+  float acceleration = point.acceleration * timeScale * timeScale;
+
+  // encoder degrees the motor turned while slipping did not move the robot
+  float leftPosition = left_wheel.get_position() - cmToDegrees(leftSlipLoss);
+  float rightPosition = right_wheel.get_position() - cmToDegrees(rightSlipLoss);
+
+  // The PID gets the tracking error as its measurement, this way the derivative term
+  // damps the velocity error and does not fight the feedforward.
+  float leftError = cmToDegrees(point.position * leftScale) - leftPosition;
+  float rightError = cmToDegrees(point.position * rightScale) - rightPosition;
+  float leftVoltage = ffVoltage(leftFF, velocity * leftScale, acceleration * leftScale)
+                      + leftPID.step(0, -leftError);
+  float rightVoltage = ffVoltage(rightFF, velocity * rightScale, acceleration * rightScale)
+                      + rightPID.step(0, -rightError);
+
+  driveSetVoltage(leftVoltage, rightVoltage);
+
+  // We need to make sure motors reach there target +- DRIVE_TOLERANCE degrees.
+  if(profileTime >= profileDuration(profile) &&
+     fabsf(leftTarget - leftPosition) < DRIVE_TOLERANCE &&
+     fabsf(rightTarget - rightPosition) < DRIVE_TOLERANCE) {
+    settled++;
+  } else {
+    settled = 0;
+  }
+
+  if(settled >= DRIVE_SETTLE_TICKS || pros::millis() > timeout) {
+    if(DEBUG) {
+      if(settled < DRIVE_SETTLE_TICKS) { std::cout << "Move timed out!\n"; }
+      std::cout << "Encoder Left: " << left_wheel.get_position() << " Right: " << right_wheel.get_position() << "\n";
+      std::cout << "Slip samples: " << slipSampleCount << " lost cm left: " << leftSlipLoss
+                << " right: " << rightSlipLoss << "\n";
+    }
+    stop();
+  }
+  return done;
+}
+
+bool DriveMove::isDone() {
+  return done;
+}
+
+float DriveMove::getTravelled() {
+  float leftCm = degreesToCm(left_wheel.get_position()) - leftSlipLoss;
+  float rightCm = degreesToCm(right_wheel.get_position()) - rightSlipLoss;
+  return fmaxf(fabsf(leftCm), fabsf(rightCm));
+}
+
+void DriveMove::stop() {
+  // we will stop the motors
+  left_wheel.move_velocity(0);
+  right_wheel.move_velocity(0);
+  done = true;
+}
+
+// ------------------- run drive move ------------------------------------------------
+// Blocks until the started move is finished, keeping the DRIVE_LOOP_MS loop timing
+void runDriveMove(DriveMove &move) {
+  std::uint32_t now = pros::millis();
+  triggersBegin();
+  while(!move.step()) {
+    triggersCheck(move.getTravelled());   // position triggers, see triggers.cpp
+    pros::Task::delay_until(&now, DRIVE_LOOP_MS);
+  }
+  triggersEnd();
+}
 
 // ------------------- drive for distance --------------------------------------------
 // Below is a generic drive for distance function, which can be called anywhere
@@ -37,31 +209,14 @@ void driveForDistance(float distance, int speed) {
 
   // We use drivebase.hpp to set the wheel diameter
   float degreesTravel = (distance / (3.14 * WHEEL_DIAM)) * 360;
-  // set the "window" for which we need to encoder to reach and stop movement
-  float degreesTravelAbs = fabsf(degreesTravel);        // we are doing absolute values
-  float minTarget = degreesTravelAbs -5;                // we can also go backwards by
-  float maxTarget = degreesTravelAbs +5;                // giving a -distance as input!
-
-  left_wheel.tare_position();       // ensure encoders are reset before
-  right_wheel.tare_position();      // movement.
-  left_wheel.move_absolute(degreesTravel, speed);
-  right_wheel.move_absolute(degreesTravel, speed);
 
   if(DEBUG){
      std::cout << "\ndriveForDistance -- distance: " << distance << " speed: " << speed << "\n";
      std::cout << "Degrees to travel: " << degreesTravel << "\n";
-     std::cout << "minTarget: " << minTarget << " maxTarget: " << maxTarget << "\n";
-  }
-  // We need to make sure motors reach there target +- 5 degrees.
-  while (!((fabs(left_wheel.get_position()) < (maxTarget)) && (fabs(left_wheel.get_position()) > minTarget))) {
-    pros::delay(2);
   }
-  if(DEBUG) {
-    std::cout << "Encoder Left: " << left_wheel.get_position() << " Right: " << right_wheel.get_position() << "\n";
-  }
-  // we will stop the motors
-  left_wheel.move_velocity(0);
-  right_wheel.move_velocity(0);
+  DriveMove move;
+  move.start(distance, distance, speed);
+  runDriveMove(move);
 }
 
 // ------------------------ pivot turn function --------------------------------------
@@ -77,45 +232,18 @@ void pivotTurn(float angle, int speed){
 
   // calculate the circumference of the turnign circle based on robot size
   // THe WHEEL_BASE in this case is the d (2 x r) of the turning circle hence dPi
-  float turnCircleCirc = 3.14 * WHEEL_BASE;
-  float toTravelCircleDistance = (angle * turnCircleCirc ) / 360;
+  float toTravelCircleDistance = pivotDistance(angle);   // (angle * 3.14 * WHEEL_BASE) / 360
   float degreesTravel = (toTravelCircleDistance / (3.14 * WHEEL_DIAM)) * 360;
 
-  float degreesTravelAbs = fabsf(degreesTravel);
-  float minTarget = degreesTravelAbs -5;
-  float maxTarget = degreesTravelAbs +5;
-
-  left_wheel.tare_position();       // ensure encoders are reset before
-  right_wheel.tare_position();      // movement.
-
   if(DEBUG){
     std::cout << "\nPivot Turn Function -- " << " speed: " << speed << "\n";
     std::cout << "Degrees to travel: " << degreesTravel << " Angle: " << angle << "\n";
-    std::cout << "minTarget: " << minTarget << " maxTarget: " << maxTarget << "\n";
   }
 
-  if(angle >= 0) {
-    //clockwise
-    left_wheel.move_absolute(degreesTravel, speed);
-    right_wheel.move_absolute(-degreesTravel, speed);
-  }
-  if (angle <= 0){
-    // counter clockwise
-    left_wheel.move_absolute(degreesTravel, speed);
-    right_wheel.move_absolute(-degreesTravel, speed);
-  }
-
-  // We need to make sure motors reach there target +- 5 degrees.
-  while (!((fabs(left_wheel.get_position()) < (maxTarget)) && (fabs(left_wheel.get_position()) > minTarget))) {
-    pros::delay(2);
-  }
-  // we sill stop the motors
-  left_wheel.move_velocity(0);
-  right_wheel.move_velocity(0);
-
-  if(DEBUG) {
-    std::cout << "Encoder Left: " << left_wheel.get_position() << " Right: " << right_wheel.get_position() << "\n";
-  }
+  // clockwise: left wheel forward, right wheel backward - a negative angle flips both
+  DriveMove move;
+  move.start(toTravelCircleDistance, -toTravelCircleDistance, speed);
+  runDriveMove(move);
 }
 
 // ----------------------- autonomous mode drive task ---------------------------------------
@@ -127,17 +255,15 @@ void driveTaskFnc(void* ignore) {
     //generic value or structure to the task if needed
     //pros needs this parameter in your function even if you don't use it
 
-    // lets start with movement and intake off by signaling the intake task via runIntakeNow
-    // to be stopped - false
-    runIntakeNow = false;                 // intake stopped
-    reverseIntake = false;                // intake direction clockwise
-    driveForDistance(100, 50);            // move forward for 100cm at 50RPM
-    runIntakeNow = true;                  // turn intake on
-    driveForDistance(50, 50);             // move forward for 50cm at 50RPM
-    reverseIntake = true;                 // intake direction counter clockwise
+    // lets start with movement and intake off by sending the intake task a stop event
+    intakePost(INTAKE_EV_STOP);           // intake stopped
+    // the intake is switched while the robot moves, by triggers (see triggers.cpp)
+    triggerAtDistance(100, INTAKE_EV_INTAKE); // turn intake on at 100cm
+    driveForDistance(150, 50);            // move forward for 150cm at 50RPM
+    triggerAtHeading(45, INTAKE_EV_OUTTAKE);  // intake counter clockwise at 45 degrees
     pivotTurn(90, 25);                    // make 90 degree clockwise turn at 25 RPM
-    reverseIntake = false;                // reverse intake back to clockwise
+    intakePost(INTAKE_EV_INTAKE);         // intake back to clockwise
     pros::delay(300);                     // run the intake for 300ms or their about
-    runIntakeNow = false;                 // stop intake
+    intakePost(INTAKE_EV_STOP);           // stop intake
     driveForDistance(-100, 50);           // drive backwards for 100cm at 50RPM
 }
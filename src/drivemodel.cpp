@@ -0,0 +1,51 @@
+// ------- drivemodel.cpp ---------------------------------------------------------
+//
+// Use drivemodel.cpp together with drivemodel.hpp to know how long a drivebase move takes
+// before it is driven.  A DriveMove (drivebase.cpp) follows a trapezoidal motion profile
+// (profile.cpp), so its time is the profile time plus the few control loops it needs
+// to settle on the target.  The host tool tools/autotime.cpp uses this to check if an
+// autonomous routine fits in its time, without a robot.
+
+#include <cmath>
+#include "drivemodel.hpp"
+#include "feedforward.hpp"
+#include "profile.hpp"
+
+// ------------------- maximum velocity ----------------------------------------------
+// speed in RPM to wheel speed in cm/s, never more than the motors can reach
+float driveMaxVelocity(int speed) {
+  float maxVel = (speed * 3.14 * WHEEL_DIAM) / 60;
+  return fminf(maxVel, fminf(ffMaxVelocity(leftFF), ffMaxVelocity(rightFF)));
+}
+
+// The WHEEL_BASE is the diameter of the turning circle of a pivot turn
+float pivotDistance(float angle) {
+  return (angle * 3.14 * WHEEL_BASE) / 360;
+}
+
+// ------------------- move time -----------------------------------------------------
+// The same profile DriveMove::start() plans: the side which travels furthest sets it.
+// The move is done DRIVE_SETTLE_TICKS loops after the profile ended, and DriveMove
+// gives up after twice the profile time + 1 sec.
+
+moveTime timeDriveSides(float leftDistance, float rightDistance, int speed) {
+  float longest = fmaxf(fabsf(leftDistance), fabsf(rightDistance));
+  motionProfile profile = profileCreate(longest, driveMaxVelocity(speed), DRIVE_MAX_ACCEL);
+  float duration = profileDuration(profile);
+
+  // the profile ends in the middle of a loop, settling starts at the next one
+  float loops = ceilf(duration * 1000 / DRIVE_LOOP_MS) + DRIVE_SETTLE_TICKS;
+  moveTime time;
+  time.expected = loops * DRIVE_LOOP_MS / 1000;
+  time.timeout = 1 + 2 * duration;
+  return time;
+}
+
+moveTime timeDrive(float distance, int speed) {
+  return timeDriveSides(distance, distance, speed);
+}
+
+moveTime timeTurn(float angle, int speed) {
+  float distance = pivotDistance(angle);
+  return timeDriveSides(distance, -distance, speed);
+}
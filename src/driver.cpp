@@ -0,0 +1,138 @@
+// ------- driver.cpp ---------------------------------------------------------
+//
+// Use driver.cpp together with driver.hpp to drive the robot with the controller.
+//
+// The drive should feel direct, so the time from the stick to the motor is kept short:
+//  - the loop runs at a high priority, nothing else can push it back
+//  - each loop reads the sticks once, works out both voltages and writes both motors
+//    right after that - reporting and measuring comes after the motors are written
+//  - deadband and curve are not calculated every loop, they are done once into a table
+//    of 128 voltages, one for every stick value, so shaping a stick is one array read
+//  - the motors get a voltage (move_voltage), not a velocity: the motor does not have
+//    to run its own velocity controller first
+//
+// What is left is the controller radio and the motor update rate, which we can not
+// change but do measure: see the response time below.
+
+#include <cmath>
+#include "main.h"
+#include "globals.hpp"
+#include "feedforward.hpp"
+#include "drivebase.hpp"
+#include "driver.hpp"
+#include "motorhealth.hpp"
+
+std::uint32_t driverLoopMaxUs = 0;
+std::uint32_t driverResponseMs = 0;
+
+// mV for stick values 0..127, the sign of the stick is put back on afterwards
+static std::int16_t driveCurve[128];
+static std::int16_t turnCurve[128];
+
+// ------------------- curve tables ------------------------------------------------
+// Inside the deadband the voltage is 0.  Just outside it the wheels get the voltage
+// which just gets them moving (kS of the feedforward, feedforward.hpp), so the first
+// bit of stick already moves the robot.  From there an exponential curve goes to the
+// full voltage: small sticks give fine control, a full stick gives full speed.
+
+static void buildCurve(std::int16_t* table, float expo, float gain) {
+  float start = fminf(leftFF.kS, rightFF.kS);
+  for(int stick = 0; stick < 128; stick++) {
+    if(stick <= DRIVER_DEADBAND) {
+      table[stick] = 0;
+      continue;
+    }
+    float x = (stick - DRIVER_DEADBAND) / (127.0 - DRIVER_DEADBAND);   // 0..1
+    float y = (expo > 0) ? (expf(expo * x) - 1) / (expf(expo) - 1) : x;
+    table[stick] = (start + (FF_MAX_VOLTAGE - start) * y) * gain;
+  }
+}
+
+static int shape(const std::int16_t* table, int stick) {
+  if(stick >= 0) {
+    return table[stick > 127 ? 127 : stick];
+  }
+  return -table[stick < -127 ? 127 : -stick];
+}
+
+// ------------------- slew --------------------------------------------------------
+// The voltage may only change by a limited step every loop, which keeps the wheels
+// from spinning on a sudden full stick.  Slowing down may go faster than speeding up.
+
+static int slew(int current, int target) {
+  bool speedUp = (target > 0 && target > current && current >= 0) ||
+                 (target < 0 && target < current && current <= 0);
+  int limit = speedUp ? DRIVER_SLEW_UP : DRIVER_SLEW_DOWN;
+  if(target > current + limit) {
+    return current + limit;
+  }
+  if(target < current - limit) {
+    return current - limit;
+  }
+  return target;
+}
+
+static int clampVoltage(int voltage) {
+  return voltage > FF_MAX_VOLTAGE ? FF_MAX_VOLTAGE :
+         voltage < -FF_MAX_VOLTAGE ? -FF_MAX_VOLTAGE : voltage;
+}
+
+// ----------------------- driver control loop ---------------------------------------
+// Runs in the opcontrol task itself, raised to a high priority.  PROS ends the opcontrol
+// task when the robot is disabled or goes to autonomous, and with it this loop - a task of
+// its own would keep driving the wheels against the autonomous.
+
+void driverControl() {
+    pros::Task::current().set_priority(DRIVER_PRIORITY);
+    buildCurve(driveCurve, DRIVER_DRIVE_EXPO, 1.0);
+    buildCurve(turnCurve, DRIVER_TURN_EXPO, DRIVER_TURN_GAIN);
+
+    int leftVoltage = 0;
+    int rightVoltage = 0;
+    bool wasCentered = true;
+    std::uint32_t stepStart = 0;        // us, 0 = no response measurement running
+    int loops = 0;
+
+    std::uint32_t now = pros::millis();   // time stamp in milli sec
+    while(true) {
+      // ---- stick to motor, nothing else in between ----
+      std::uint32_t readTime = pros::micros();
+      int forward = master.get_analog(pros::E_CONTROLLER_ANALOG_LEFT_Y);
+      int turn = master.get_analog(pros::E_CONTROLLER_ANALOG_RIGHT_X);
+
+      int drivePart = shape(driveCurve, forward);
+      int turnPart = shape(turnCurve, turn);
+      float cap = healthDriveCap();               // lower when the motors get hot
+      leftVoltage = slew(leftVoltage, clampVoltage((drivePart + turnPart) * cap));
+      rightVoltage = slew(rightVoltage, clampVoltage((drivePart - turnPart) * cap));
+      driveSetVoltage(leftVoltage, rightVoltage); // same feel on a full or used battery
+      std::uint32_t loopTime = pros::micros() - readTime;
+
+      // ---- measuring, after the motors have their voltage ----
+      if(loopTime > driverLoopMaxUs) {
+        driverLoopMaxUs = loopTime;
+      }
+      // a stick leaving the center while the robot stands still starts a response
+      // measurement - the first loop which asks the motors to move - it ends when the
+      // motors report a wheel is turning
+      bool centered = abs(forward) <= DRIVER_DEADBAND && abs(turn) <= DRIVER_DEADBAND;
+      bool turning = fabs(left_wheel.get_actual_velocity()) >= DRIVER_STEP_RPM ||
+                     fabs(right_wheel.get_actual_velocity()) >= DRIVER_STEP_RPM;
+      if(wasCentered && !centered && !turning) {
+        stepStart = readTime;
+      } else if(centered) {
+        stepStart = 0;                  // back to center before a wheel turned
+      }
+      wasCentered = centered;
+      if(stepStart != 0 && turning) {
+        driverResponseMs = (pros::micros() - stepStart) / 1000;
+        stepStart = 0;
+        if(DEBUG) { std::cout << "Stick to wheel response: " << driverResponseMs << "ms\n"; }
+      }
+      if(++loops % 100 == 0) {
+        pros::lcd::print(2, "Loop %4luus  Response %3lums", (unsigned long)driverLoopMaxUs,
+                         (unsigned long)driverResponseMs);
+      }
+      pros::Task::delay_until(&now, DRIVER_LOOP_MS);
+    }
+}
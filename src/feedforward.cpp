@@ -0,0 +1,33 @@
+// ------- feedforward.cpp ---------------------------------------------------------
+//
+// Use feedforward.cpp together with feedforward.hpp to turn a velocity and acceleration
+// of a drive wheel into the motor voltage which should give that motion.  The constants
+// start at nominal values and can be replaced by the characterization routine.
+
+#include "feedforward.hpp"
+
+ffGains leftFF = {FF_LEFT_KS, FF_LEFT_KV, FF_LEFT_KA};
+ffGains rightFF = {FF_RIGHT_KS, FF_RIGHT_KV, FF_RIGHT_KA};
+
+// ------------------- feedforward voltage -------------------------------------------
+// velocity in cm/s, acceleration in cm/s^2, returns mV
+float ffVoltage(const ffGains &gains, float velocity, float acceleration) {
+  float voltage = gains.kV * velocity + gains.kA * acceleration;
+  if(velocity > 0) {
+    voltage += gains.kS;
+  } else if(velocity < 0) {
+    voltage -= gains.kS;
+  }
+  if(voltage > FF_MAX_VOLTAGE) {
+    voltage = FF_MAX_VOLTAGE;
+  }
+  if(voltage < -FF_MAX_VOLTAGE) {
+    voltage = -FF_MAX_VOLTAGE;
+  }
+  return voltage;
+}
+
+// ------------------- maximum velocity ----------------------------------------------
+float ffMaxVelocity(const ffGains &gains) {
+  return (FF_MAX_VOLTAGE - gains.kS) / gains.kV;
+}
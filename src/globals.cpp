@@ -19,12 +19,18 @@ pros::Motor right_wheel (RIGHT_MOTOR_PORT, MOTOR_GEARSET_36, true, pros::E_MOTOR
 // intake motor used to demonstrate tasks during autonomous
 pros::Motor intake_motor (INTAKE_MOTOR_PORT, MOTOR_GEARSET_18, false, pros::E_MOTOR_ENCODER_DEGREES);
 
+// optical sensor looking at the game objects coming into the intake
+pros::Optical intake_optical(INTAKE_OPTICAL_PORT);
+
 // we have two odomoters - left and right which are the new VEX odometers in this case
 // which will report the movement of the front left and right whell - the none motor
 // driven wheels
 pros::Rotation left_odom(LEFT_ODOM_PORT);
 pros::Rotation right_odom(RIGHT_ODOM_PORT);
 
+// the driver's controller
+pros::Controller master(pros::E_CONTROLLER_MASTER);
+
 int motorMaxSpeed = 50;            // Maximum movement speed
 const int motorDefaultSpeed = 75;  // our default movement speed
 const int maxAllowedSpeed = 100;   // a constant maximum allowed speed
@@ -10,8 +10,10 @@
 #include "main.h"
 #include "globals.hpp"
 #include "portdef.hpp"
+#include "pros/apix.h"          // RTOS queue for the intake events
 #include "intake.hpp"
 #include "tasks.hpp"
+#include "motorhealth.hpp"
 
 // ------------------------------- intakeRun function ---------------------------------
 // control the running of the intake includign stopping and direction at given RPM controlled
@@ -27,44 +29,245 @@ void runIntake(int speed){
     // stop the intake
     intake_motor.move_velocity(0);
   } else {
-    // run intake at given RPM (- equals counter clockwise)
-    intake_motor.move_velocity(speed);
+    // run intake at given RPM (- equals counter clockwise), slower when the motor gets
+    // hot (see motorhealth.cpp)
+    intake_motor.move_velocity(speed * healthIntakeCap());
   }
 }
 
-// ----------------------- autonomous mode intake task ---------------------------------------
-// The function intakeTaskFnc() will be called by the autoTask() function and ontrols the
-// intake via  a seperate task during the autonomous period.
+// ------------------------------- jam detection ---------------------------------------
+// A jammed intake is commanded to turn but hardly moves, while the motor pulls a lot of
+// current or pushes a lot of torque.  A motor that is just speeding up looks the same,
+// so we skip the checks right after a new command.  One sample can be noise, the jam
+// has to be seen INTAKE_JAM_SAMPLES times in a row - with the 10ms loop a stall is
+// detected after 40ms.
+
+int intakeJamCount = 0;             // jams cleared since program start
+bool intakeJammed = false;          // gave up clearing jams, see intake.hpp
+
+static int jamSamples = 0;          // samples in a row which looked jammed
+static std::uint32_t commandTime = 0;   // when the current command started
+
+void intakeJamReset() {
+  jamSamples = 0;
+  commandTime = pros::millis();
+}
+
+bool intakeJamCheck(int speed) {
+  if(speed == 0 || pros::millis() - commandTime < INTAKE_SPINUP_MS) {
+    jamSamples = 0;
+    return false;
+  }
+  double velocity = intake_motor.get_actual_velocity();     // RPM
+  std::int32_t current = intake_motor.get_current_draw();   // mA
+  double torque = intake_motor.get_torque();                // Nm
+
+  // slow, or even turning the wrong way, compared to what we asked for
+  bool slow = (velocity * speed) < (INTAKE_JAM_VEL_RATIO * speed * speed);
+  bool straining = current > INTAKE_JAM_CURRENT || torque > INTAKE_JAM_TORQUE;
+  if(slow && straining) {
+    jamSamples++;
+  } else {
+    jamSamples = 0;
+  }
+  return jamSamples >= INTAKE_JAM_SAMPLES;
+}
+
+// ------------------------------- intake events ---------------------------------------
+// Other tasks do not drive the intake motor, they post events with intakePost().  The
+// events wait in an RTOS queue and the intake task is woken with a task notification,
+// so it reacts to an event right away and sleeps the rest of the time.
+// We use the RTOS queue (advanced API) and not our own buffer with a mutex, as
+// killTasks() could remove a task while it holds the mutex and block the intake forever.
+
+static pros::c::queue_t eventQueue = pros::c::queue_create(INTAKE_QUEUE_SIZE, sizeof(intakeEvent_e));
+
+bool intakePost(intakeEvent_e event) {
+  bool queued = pros::c::queue_append(eventQueue, &event, 0);
+  if(intake) {
+    pros::Task(intake).notify();    // wake the intake task
+  }
+  if(!queued && DEBUG) { std::cout << "Intake event queue full \n";}
+  return queued;
+}
+
+// ------------------------------- state machine ---------------------------------------
+//   IDLE       motor off, free to turn
+//   INTAKING   running inwards at INTAKE_SPEED, checking for jams
+//   OUTTAKING  running outwards at INTAKE_OUTTAKE_SPEED, checking for jams
+//   UNJAMMING  short reverse pulse, then back to INTAKING or OUTTAKING
+//   HOLDING    motor stopped and actively holding its position
+//   EJECTING   short outwards pulse to throw out a wrong color object, then back to
+//              INTAKING
+//
+// Events move the intake between states.  A jam moves INTAKING or OUTTAKING to
+// UNJAMMING, and the end of the pulse moves it back.  If it keeps jamming we go to IDLE
+// and set intakeJammed, so the motor does not overheat.
+// The optical sensor (colorsort.cpp) posts an event for every object coming in: one of
+// our color is counted, and once we hold INTAKE_CAPACITY objects we stop and hold them.
+// One of the wrong color is thrown out again.
+
+static intakeState_e state = INTAKE_IDLE;
+static intakeState_e resumeState = INTAKE_IDLE;     // where a pulse goes back to
+static std::uint32_t pulseUntil = 0;                // end of the unjam / eject pulse
+static std::uint32_t firstJamTime = 0;              // time of the first jam in a row
+static int jamsInRow = 0;
+
+int intakeObjectCount = 0;          // objects of our color in the intake
+
+intakeState_e intakeGetState() {
+  return state;
+}
+
+static int speedOf(intakeState_e runState) {
+  return (runState == INTAKE_OUTTAKING) ? INTAKE_OUTTAKE_SPEED : INTAKE_SPEED;
+}
+
+static void enterState(intakeState_e newState, std::uint32_t now) {
+  if(DEBUG && newState != state) { std::cout << "Intake state " << state << " -> " << newState << "\n";}
+  state = newState;
+  switch(state) {
+    case INTAKE_INTAKING:
+    case INTAKE_OUTTAKING:
+      intake_motor.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
+      runIntake(speedOf(state));
+      intakeJamReset();
+      break;
+
+    case INTAKE_UNJAMMING:
+      // reverse against the direction we were running
+      pulseUntil = now + INTAKE_UNJAM_MS;
+      runIntake((speedOf(resumeState) > 0) ? INTAKE_UNJAM_SPEED : -INTAKE_UNJAM_SPEED);
+      break;
+
+    case INTAKE_EJECTING:
+      pulseUntil = now + INTAKE_EJECT_MS;
+      runIntake(INTAKE_EJECT_SPEED);
+      break;
+
+    case INTAKE_HOLDING:
+      intake_motor.set_brake_mode(pros::E_MOTOR_BRAKE_HOLD);
+      runIntake(0);
+      break;
+
+    case INTAKE_IDLE:
+    default:
+      intake_motor.set_brake_mode(pros::E_MOTOR_BRAKE_COAST);
+      runIntake(0);
+      break;
+  }
+}
+
+// asked to run inwards or outwards - while unjamming we first finish the pulse
+static void runState(intakeState_e runState, std::uint32_t now) {
+  intakeJammed = false;
+  jamsInRow = 0;
+  if(state == INTAKE_UNJAMMING || state == INTAKE_EJECTING) {
+    resumeState = runState;
+  } else if(state != runState) {
+    enterState(runState, now);
+  }
+}
+
+static void handleEvent(intakeEvent_e event, std::uint32_t now) {
+  switch(event) {
+    case INTAKE_EV_INTAKE:
+      runState(INTAKE_INTAKING, now);
+      break;
+    case INTAKE_EV_OUTTAKE:
+      intakeObjectCount = 0;          // everything goes out
+      runState(INTAKE_OUTTAKING, now);
+      break;
+    case INTAKE_EV_OBJECT_OURS:
+      if(state == INTAKE_INTAKING) {
+        intakeObjectCount++;
+        if(intakeObjectCount >= INTAKE_CAPACITY) {
+          enterState(INTAKE_HOLDING, now);      // full - keep what we have
+        }
+      }
+      break;
+    case INTAKE_EV_OBJECT_WRONG:
+      if(state == INTAKE_INTAKING) {
+        resumeState = INTAKE_INTAKING;
+        enterState(INTAKE_EJECTING, now);
+      }
+      break;
+    case INTAKE_EV_HOLD:
+      enterState(INTAKE_HOLDING, now);
+      break;
+    case INTAKE_EV_STOP:
+    default:
+      enterState(INTAKE_IDLE, now);
+      break;
+  }
+}
+
+// timers: end of the unjam pulse, and the jam check while running
+static void handleTimers(std::uint32_t now) {
+  if(state == INTAKE_UNJAMMING || state == INTAKE_EJECTING) {
+    if(now >= pulseUntil) {
+      enterState(resumeState, now);
+    }
+    return;
+  }
+  if(state != INTAKE_INTAKING && state != INTAKE_OUTTAKING) {
+    return;
+  }
+  if(!intakeJamCheck(speedOf(state))) {
+    return;
+  }
+  if(jamsInRow == 0 || now - firstJamTime > INTAKE_JAM_WINDOW_MS) {
+    jamsInRow = 0;
+    firstJamTime = now;
+  }
+  jamsInRow++;
+  intakeJamCount++;
+  if(jamsInRow > INTAKE_MAX_UNJAMS) {
+    intakeJammed = true;
+    enterState(INTAKE_IDLE, now);
+    if(DEBUG) { std::cout << "Intake keeps jamming - stopped \n";}
+  } else {
+    resumeState = state;
+    enterState(INTAKE_UNJAMMING, now);
+    if(DEBUG) { std::cout << "Intake jam " << jamsInRow << " - reversing \n";}
+  }
+}
+
+// how long the task may sleep if no event comes in
+static std::uint32_t sleepTime(std::uint32_t now) {
+  switch(state) {
+    case INTAKE_INTAKING:
+    case INTAKE_OUTTAKING:
+      return INTAKE_LOOP_MS;                      // motor sensors for jam detection
+    case INTAKE_UNJAMMING:
+    case INTAKE_EJECTING:
+      return (pulseUntil > now) ? pulseUntil - now : 0;
+    default:
+      return TIMEOUT_MAX;                         // nothing to do until an event
+  }
+}
+
+// ----------------------- intake task ---------------------------------------
+// The function intakeTaskFnc() runs the intake state machine.  It is started by the
+// autoTask() function and controls the intake via a seperate task during the autonomous
+// period - other tasks post events with intakePost().
+//
+// The task sleeps in notify_take() until an event is posted or the next timer is due,
+// while the intake is IDLE or HOLDING it does not use any processor time at all.
 
 void intakeTaskFnc(void* ignore) {
     //the void* is there to provide a way to pass a
     //generic value or structure to the task if needed
     //pros needs this parameter in your function even if you don't use it
 
-    // Run task permanently until removed from rtos task list, ensure no starvation
-    // of CPU to occur
-
-    int speed = 75;                     // clockwise speed in RPM
-    int reverseSpeed = -50;             // counter clockwise speed in RPM
-
+    enterState(INTAKE_IDLE, pros::millis());
     while (true) {
-      if(runIntakeNow) {                // runIntakeNow is global flag for inter
-                                        // task communication
-        if(DEBUG) { std::cout << "Running Intake Task \n";}
-        // we are asked to run the intake - now what direction?
-        if(reverseIntake){              // reverseIntake is a global flag for
-                                        // inter task communication
-          // run counter clockwise
-          if(DEBUG) { std::cout << "Reversing directions \n";}
-
-          runIntake(reverseSpeed);    // counter clockwise at reverseSpeed
-        } else {
-          runIntake(speed);           // clockwise at speed
-        }
-      } else {
-        runIntake(0);                 // stop intake
-        if(DEBUG) { std::cout << "Stopped intake Task \n";}
+      std::uint32_t now = pros::millis();
+      intakeEvent_e event;
+      while(pros::c::queue_recv(eventQueue, &event, 0)) {
+        handleEvent(event, now);
       }
-      pros::delay(20);                // ensure task will not starve processor
+      handleTimers(now);
+      pros::Task::notify_take(true, sleepTime(now));
     }
 }
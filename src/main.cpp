@@ -21,6 +21,17 @@
 #include "tasks.hpp"			// Include the definition of the various task functions
 													// and variables
 
+#include "velocity.hpp"		// odometer wheel velocity estimators, see velocity.cpp
+#include "planner.hpp"		// route planner field map, see planner.cpp
+#include "colorsort.hpp"	// optical sensor color sorting, see colorsort.cpp
+#include "autoscript.hpp"	// autonomous scripts from the SD card, see autoscript.cpp
+#include "recorder.hpp"		// record a route while driving, see recorder.cpp
+#include "driver.hpp"			// driver control, see driver.cpp
+#include "motorhealth.hpp"	// motor temperature monitor, see motorhealth.cpp
+#include "battery.hpp"			// battery voltage compensation, see battery.cpp
+#include "power.hpp"				// motor current budget, see power.cpp
+#include "triggers.hpp"			// actions during a motion, see triggers.cpp
+
 /**
  * Runs initialization code. This occurs as soon as the program is started.
  *
@@ -74,6 +85,50 @@ void initialize() {
 								TASK_STACK_DEPTH_DEFAULT, "Odomoter Task"); //starts the task
 	// no need to provide any other parameters
 
+	// Lets start the velocity estimator task, it runs at the rotation sensor rate and
+	// gives the drivebase clean odometer wheel velocities (see velocity.cpp).  It runs
+	// one priority higher so the estimates are never late.
+	leftOdomVelocity.setFilter(VEL_FILTER_TRACKING);
+	rightOdomVelocity.setFilter(VEL_FILTER_TRACKING);
+	velocity = pros::Task (velocityTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT + 1,
+								TASK_STACK_DEPTH_DEFAULT, "Velocity Task"); //starts the task
+
+	// Lets start the optical sensor task, it watches the game objects coming into the
+	// intake and tells the intake task to keep or eject them (see colorsort.cpp).  It
+	// runs one priority higher as fast objects only pass the sensor for a moment.
+	allianceColor = OBJECT_UNKNOWN;		// CHANGE to OBJECT_RED or OBJECT_BLUE to sort
+	optical = pros::Task (colorSortTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT + 1,
+								TASK_STACK_DEPTH_DEFAULT, "Optical Task"); //starts the task
+
+	// Lets start the motor health monitor, it predicts when a motor gets too hot and
+	// lowers the speed caps a little before that happens (see motorhealth.cpp)
+	monitor = pros::Task (healthTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT,
+								TASK_STACK_DEPTH_DEFAULT, "Health Task"); //starts the task
+
+	// Lets start the battery monitor, all drive voltages are scaled with its reading so
+	// the robot drives the same on a full and a used battery (see battery.cpp).  It runs
+	// one priority higher so the reading is fresh for the control loops
+	battery = pros::Task (batteryTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT + 1,
+								TASK_STACK_DEPTH_DEFAULT, "Battery Task"); //starts the task
+
+	// Lets start the power manager, it shares the current between the drive and the
+	// intake every 10ms by need (see power.cpp).  It runs above driver control so a
+	// new limit is set before the next control loop
+	power = pros::Task (powerTaskFnc, (void*)"PROS", TASK_PRIORITY_MAX - 1,
+								TASK_STACK_DEPTH_DEFAULT, "Power Task"); //starts the task
+
+	// Trajectories made on the brain are generated once and saved on the SD card, on
+	// the next boot they are read back from the card (see trajcache.cpp)
+	prepareTrajectories();
+
+	// Build the field map for the route planner (see planner.cpp)
+	planInit();
+
+	// Load the autonomous scripts from the SD card once, each into its own slot.  If there
+	// is one auto45sec() or autoSkill() runs it instead of its built in routine (see
+	// autoscript.cpp and tools/autoc.cpp)
+	scriptLoad(SCRIPT_SLOT_AUTO45, "auto45sec");
+	scriptLoad(SCRIPT_SLOT_SKILL, "autoSkill");
 }
 
 /**
@@ -81,7 +136,10 @@ void initialize() {
  * the VEX Competition Switch, following either autonomous or opcontrol. When
  * the robot is enabled, this task will exit.
  */
-void disabled() {}
+void disabled() {
+	// save the battery sag log of the match to the SD card (see battery.cpp)
+	batterySaveLog();
+}
 
 /**
  * Runs after initialize(), and before autonomous when connected to the Field
@@ -120,11 +178,32 @@ void autonomous() {
 	//
 	// autoTask()		--	a sample autonomous using tasks and inter task synchronization
 	//
+	// autoCharacterize() -- measure the drivebase constants (needs 150cm free space)
+	//
+	// autoPursuit()	--	sample autonomous following a curved path with pure pursuit
+	//
+	// autoTrajectory() -- sample autonomous driving a precompiled trajectory (RAMSETE)
+	//
+	// autoCachedTrajectory() -- sample autonomous driving a trajectory cached on SD
+	//
+	// autoPlanned()		--	sample autonomous driving a route found by the planner
+	//
+	// autoReplay()		--	drive the route recorded in opcontrol() (see recorder.cpp)
+	//
+
+	// a trigger added before an earlier routine ended must not fire in this one
+	triggersClear();
 
   // comment / uncomment the one to use
 	auto45sec();				// 45 second autonomous
 	//autoSkill();				// 2 minute autonomous code
 	//autoTask();					// sample autonomous using tasks
+	//autoCharacterize();	// drivebase characterization
+	//autoPursuit();			// pure pursuit path sample
+	//autoTrajectory();		// precompiled trajectory sample
+	//autoCachedTrajectory();	// cached trajectory sample
+	//autoPlanned();				// planned route sample
+	//autoReplay();				// recorded route
 }
 
 /**
@@ -142,11 +221,23 @@ void autonomous() {
  */
 void opcontrol() {
 	// Call one of the three autonomous functions here for testing
-	// comment/uncomment one of thefunctions
+	// comment/uncomment one of thefunctions - and the driver control below
 
 	//auto45sec();					// 45 sec autonomous routine
 
 	//autoSkill();					// 2minute autonomous routine
 
-	autoTask();						// sample autonomous using tasks
+	//autoTask();						// sample autonomous using tasks
+
+	// Driver control: stop what autonomous left running first
+	killTasks();
+
+	// To make a route for autoReplay() uncomment recordStart(): what the driver drives
+	// from here on is saved to the SD card when button B is pressed (see recorder.cpp)
+	//recordStart();
+
+	// The driver control loop runs right here in the opcontrol task, at a high priority so
+	// a stick movement reaches the motors in the same 10ms loop, no matter what other
+	// tasks are doing.  It never returns - PROS ends it with opcontrol (see driver.cpp)
+	driverControl();
 }
@@ -0,0 +1,151 @@
+// ------- motorhealth.cpp ---------------------------------------------------------
+//
+// Use motorhealth.cpp together with motorhealth.hpp to keep an eye on the motors and to
+// slow the robot down a little before a motor gets too hot.
+//
+// The thermal model: a motor heats up with the square of its current and cools down
+// towards the air temperature, that is a "first order" system.  At a steady current I
+// the motor ends up at
+//
+//    steady = ambient + HEALTH_K * I * I
+//
+// and every moment it closes a part dt / HEALTH_TAU of the gap to that temperature.  The
+// motor's own sensor only reports in 5 degree steps, the model fills in between them and
+// is pulled back to the sensor whenever it is more than half a step away.
+//
+// The prediction: if the steady temperature at the average current is above
+// HEALTH_DERATE_TEMP, the time to get there is
+//
+//    t = HEALTH_TAU * ln((steady - temperature) / (steady - HEALTH_DERATE_TEMP))
+//
+// From HEALTH_WARN_TIME before that moment the speed cap goes down from 1 to
+// HEALTH_MIN_CAP.  Less speed is less current, so the motor may never get there at all.
+//
+// The caps are used where a speed is chosen: DriveMove and the pure pursuit follower
+// (drivebase.cpp, purepursuit.cpp) at the start of a move, the driver control loop
+// (driver.cpp) and runIntake() (intake.cpp).  Trajectories are not capped, their timing
+// is fixed when they are generated.
+
+#include <cmath>
+#include "main.h"
+#include "globals.hpp"
+#include "motorhealth.hpp"
+
+// cap 1 from the start, a move planned before the monitor task first ran must not get
+// a zero speed - the task fills in the real temperatures when it starts
+//  temperature, steady, current, efficiency, faults, timeToDerate, cap
+motorHealth health[HEALTH_MOTORS] = {
+  {25, 25, 0, 0, 0, -1, 1},
+  {25, 25, 0, 0, 0, -1, 1},
+  {25, 25, 0, 0, 0, -1, 1}
+};
+
+static pros::Motor* const motors[HEALTH_MOTORS] = {&left_wheel, &right_wheel, &intake_motor};
+static const char* const motorNames[HEALTH_MOTORS] = {"left", "right", "intake"};
+static float ambient[HEALTH_MOTORS];    // C, temperature when the monitor started
+
+float healthDriveCap() {
+  return fminf(health[HEALTH_LEFT].cap, health[HEALTH_RIGHT].cap);
+}
+
+float healthIntakeCap() {
+  return health[HEALTH_INTAKE].cap;
+}
+
+// ------------------- one motor -----------------------------------------------------
+static void resetMotor(int i) {
+  double measured = motors[i]->get_temperature();
+  ambient[i] = (measured == PROS_ERR_F) ? 25 : measured;
+  health[i].temperature = ambient[i];
+  health[i].steadyTemperature = ambient[i];
+  health[i].current = 0;
+  health[i].efficiency = 0;
+  health[i].faults = 0;
+  health[i].timeToDerate = -1;
+  health[i].cap = 1;
+}
+
+static void updateMotor(int i) {
+  motorHealth &m = health[i];
+  pros::Motor &motor = *motors[i];
+  float dt = HEALTH_LOOP_MS / 1000.0;
+
+  std::int32_t currentMa = motor.get_current_draw();
+  double measured = motor.get_temperature();
+  double efficiency = motor.get_efficiency();
+  std::uint32_t faults = motor.get_faults();
+  if(currentMa == PROS_ERR) {
+    return;                           // motor unplugged, keep the last state
+  }
+  float current = currentMa / 1000.0;
+
+  // thermal model, then pulled towards the sensor when it is more than half a step off
+  float steadyNow = ambient[i] + HEALTH_K * current * current;
+  m.temperature += (steadyNow - m.temperature) * dt / HEALTH_TAU;
+  if(measured != PROS_ERR_F && fabs(measured - m.temperature) > 2.5) {
+    m.temperature += HEALTH_TEMP_BLEND * (measured - m.temperature);
+  }
+
+  // prediction at the average current
+  m.current += HEALTH_CURRENT_FILTER * (current - m.current);
+  m.steadyTemperature = ambient[i] + HEALTH_K * m.current * m.current;
+  if(m.temperature >= HEALTH_DERATE_TEMP || (measured != PROS_ERR_F && measured >= HEALTH_DERATE_TEMP)) {
+    m.timeToDerate = 0;
+  } else if(m.steadyTemperature > HEALTH_DERATE_TEMP) {
+    m.timeToDerate = HEALTH_TAU * logf((m.steadyTemperature - m.temperature) /
+                                       (m.steadyTemperature - HEALTH_DERATE_TEMP));
+  } else {
+    m.timeToDerate = -1;
+  }
+
+  // the cap follows the prediction, at most HEALTH_CAP_STEP per loop
+  float target = 1;
+  if(m.timeToDerate >= 0) {
+    float left = fminf(m.timeToDerate / HEALTH_WARN_TIME, 1);
+    target = HEALTH_MIN_CAP + (1 - HEALTH_MIN_CAP) * left;
+  }
+  if(faults != PROS_ERR && (faults & pros::E_MOTOR_FAULT_MOTOR_OVER_TEMP)) {
+    target = HEALTH_MIN_CAP;
+  }
+  m.cap += fmaxf(-HEALTH_CAP_STEP, fminf(HEALTH_CAP_STEP, target - m.cap));
+
+  if(efficiency != PROS_ERR_F) {
+    m.efficiency = efficiency;
+  }
+  if(faults != PROS_ERR && faults != m.faults) {
+    if(DEBUG) { std::cout << "Motor " << motorNames[i] << " faults: " << faults << "\n"; }
+    m.faults = faults;
+  }
+}
+
+// ----------------------- motor health task -------------------------------------------
+// Started in initialize() and never killed - the other tasks only read the caps.
+
+void healthTaskFnc(void* ignore) {
+    //the void* is there to provide a way to pass a
+    //generic value or structure to the task if needed
+    //pros needs this parameter in your function even if you don't use it
+    for(int i = 0; i < HEALTH_MOTORS; i++) {
+      resetMotor(i);
+    }
+    int loops = 0;
+    std::uint32_t now = pros::millis();   // time stamp in milli sec
+    while(true) {
+      for(int i = 0; i < HEALTH_MOTORS; i++) {
+        updateMotor(i);
+      }
+      if(++loops % 10 == 0) {
+        const motorHealth &l = health[HEALTH_LEFT];
+        const motorHealth &r = health[HEALTH_RIGHT];
+        const motorHealth &in = health[HEALTH_INTAKE];
+        pros::lcd::print(3, "Temp L%2.0f R%2.0f I%2.0f Cap %3.0f%%", l.temperature, r.temperature,
+                         in.temperature, healthDriveCap() * 100);
+        if(DEBUG && (l.cap < 1 || r.cap < 1 || in.cap < 1)) {
+          std::cout << "Motor caps left: " << l.cap << " right: " << r.cap << " intake: " << in.cap
+                    << " derate in s: " << l.timeToDerate << " " << r.timeToDerate << " "
+                    << in.timeToDerate << "\n";
+        }
+      }
+      pros::Task::delay_until(&now, HEALTH_LOOP_MS);
+    }
+}
@@ -0,0 +1,64 @@
+// ------- odometry.cpp ---------------------------------------------------------
+//
+// Use odometry.cpp together with odometry.hpp to keep track of where the robot is on the
+// field.  The two odometers (left_odom, right_odom) are not powered so they do not slip,
+// every loop we see how far each one rolled and work out how the robot moved:
+//
+//    turned  = (right - left) / ODOM_TRACK_WIDTH       (radians)
+//    moved   = (left + right) / 2                      (cm)
+//
+// The movement is added in the direction half way through the turn, which is very close
+// to the arc the robot really drove.
+
+#include "main.h"
+#include "globals.hpp"
+#include "traction.hpp"
+#include "odometry.hpp"
+
+static pose_t pose = {0, 0, 0};
+static pros::Mutex poseMutex;           // pose is written by the odometer task and read
+                                        // by the drive code, the mutex keeps x, y and
+                                        // theta from a single update together
+static double lastLeft = 0;             // odometer readings of the last update in cm
+static double lastRight = 0;
+
+static double odomCm(pros::Rotation &odom) {
+  return (odom.get_position() / 36000.0) * (3.14 * ODOM_WHEEL_DIAM);
+}
+
+// ------------------- reset ---------------------------------------------------------
+void odomReset(pose_t start) {
+  poseMutex.take(TIMEOUT_MAX);
+  pose = start;
+  lastLeft = odomCm(left_odom);
+  lastRight = odomCm(right_odom);
+  poseMutex.give();
+}
+
+// ------------------- update --------------------------------------------------------
+void odomUpdate() {
+  double left = odomCm(left_odom);
+  double right = odomCm(right_odom);
+
+  poseMutex.take(TIMEOUT_MAX);
+  double deltaLeft = left - lastLeft;
+  double deltaRight = right - lastRight;
+  lastLeft = left;
+  lastRight = right;
+
+  double turned = (deltaRight - deltaLeft) / ODOM_TRACK_WIDTH;
+  double moved = (deltaLeft + deltaRight) / 2;
+  double heading = pose.theta + turned / 2;
+  pose.x += moved * cos(heading);
+  pose.y += moved * sin(heading);
+  pose.theta += turned;
+  poseMutex.give();
+}
+
+// ------------------- get pose ------------------------------------------------------
+pose_t getPose() {
+  poseMutex.take(TIMEOUT_MAX);
+  pose_t current = pose;
+  poseMutex.give();
+  return current;
+}
@@ -0,0 +1,1462 @@
+// GENERATED by tools/pathgen.cpp from tools/paths.txt - do not edit, run "make paths"
+
+#include "pathtables.hpp"
+
+// sCurve - x, y, theta, v, omega, a
+constexpr trajPoint sCurve[S_CURVE_POINTS] = {
+  {0.00f, 0.00f, 0.0000f, 0.00f, 0.0000f, 60.00f},
+  {0.12f, 0.00f, 0.0001f, 0.60f, 0.0000f, 60.00f},
+  {0.24f, 0.00f, 0.0001f, 1.20f, 0.0001f, 60.00f},
+  {0.37f, 0.00f, 0.0002f, 1.80f, 0.0001f, 60.00f},
+  {0.49f, 0.00f, 0.0003f, 2.40f, 0.0002f, 60.00f},
+  {0.61f, 0.00f, 0.0003f, 3.00f, 0.0004f, 60.00f},
+  {0.73f, 0.00f, 0.0004f, 3.60f, 0.0006f, 60.00f},
+  {0.86f, 0.00f, 0.0005f, 4.20f, 0.0008f, 60.00f},
+  {0.98f, 0.00f, 0.0005f, 4.80f, 0.0010f, 60.00f},
+  {1.10f, 0.00f, 0.0006f, 5.40f, 0.0012f, 60.00f},
+  {1.22f, 0.00f, 0.0007f, 6.00f, 0.0015f, 60.00f},
+  {1.35f, 0.00f, 0.0007f, 6.60f, 0.0019f, 60.00f},
+  {1.47f, 0.00f, 0.0008f, 7.20f, 0.0022f, 60.00f},
+  {1.59f, 0.00f, 0.0008f, 7.80f, 0.0026f, 60.00f},
+  {1.71f, 0.00f, 0.0009f, 8.40f, 0.0030f, 60.00f},
+  {1.84f, 0.00f, 0.0010f, 9.00f, 0.0034f, 60.00f},
+  {1.96f, 0.00f, 0.0010f, 9.60f, 0.0039f, 60.00f},
+  {2.08f, 0.00f, 0.0011f, 10.20f, 0.0044f, 60.00f},
+  {2.20f, 0.00f, 0.0012f, 10.80f, 0.0050f, 60.00f},
+  {2.33f, 0.00f, 0.0012f, 11.40f, 0.0055f, 60.00f},
+  {2.45f, 0.00f, 0.0013f, 12.00f, 0.0061f, 60.00f},
+  {2.57f, 0.00f, 0.0014f, 12.60f, 0.0068f, 60.00f},
+  {2.69f, 0.00f, 0.0014f, 13.20f, 0.0074f, 60.00f},
+  {2.82f, 0.00f, 0.0015f, 13.80f, 0.0081f, 60.00f},
+  {2.94f, 0.00f, 0.0016f, 14.40f, 0.0088f, 60.00f},
+  {3.06f, 0.00f, 0.0016f, 15.00f, 0.0096f, 60.00f},
+  {3.18f, 0.00f, 0.0017f, 15.60f, 0.0104f, 60.00f},
+  {3.31f, 0.00f, 0.0018f, 16.20f, 0.0112f, 60.00f},
+  {3.43f, 0.00f, 0.0018f, 16.80f, 0.0120f, 60.00f},
+  {3.55f, 0.00f, 0.0019f, 17.40f, 0.0129f, 60.00f},
+  {3.67f, 0.00f, 0.0020f, 18.00f, 0.0138f, 60.00f},
+  {3.80f, 0.00f, 0.0020f, 18.60f, 0.0147f, 60.00f},
+  {3.92f, 0.00f, 0.0021f, 19.20f, 0.0157f, 60.00f},
+  {4.04f, 0.00f, 0.0021f, 19.80f, 0.0167f, 60.00f},
+  {4.16f, 0.00f, 0.0022f, 20.40f, 0.0177f, 60.00f},
+  {4.29f, 0.00f, 0.0023f, 21.00f, 0.0188f, 60.00f},
+  {4.41f, 0.00f, 0.0023f, 21.60f, 0.0199f, 60.00f},
+  {4.53f, 0.00f, 0.0024f, 22.20f, 0.0210f, 60.00f},
+  {4.65f, 0.00f, 0.0025f, 22.80f, 0.0221f, 60.00f},
+  {4.78f, 0.00f, 0.0025f, 23.40f, 0.0233f, 60.00f},
+  {4.90f, 0.00f, 0.0026f, 24.00f, 0.0245f, 60.00f},
+  {5.05f, 0.00f, 0.0027f, 24.55f, 0.0258f, 30.00f},
+  {5.32f, 0.01f, 0.0031f, 24.85f, 0.0274f, 30.00f},
+  {5.59f, 0.01f, 0.0036f, 25.15f, 0.0291f, 30.00f},
+  {5.87f, 0.01f, 0.0040f, 25.45f, 0.0307f, 30.00f},
+  {6.14f, 0.01f, 0.0044f, 25.75f, 0.0324f, 30.00f},
+  {6.41f, 0.01f, 0.0048f, 26.05f, 0.0341f, 30.00f},
+  {6.68f, 0.01f, 0.0052f, 26.35f, 0.0359f, 30.00f},
+  {6.96f, 0.02f, 0.0056f, 26.65f, 0.0377f, 30.00f},
+  {7.23f, 0.02f, 0.0061f, 26.95f, 0.0395f, 30.00f},
+  {7.50f, 0.02f, 0.0065f, 27.25f, 0.0413f, 30.00f},
+  {7.77f, 0.02f, 0.0069f, 27.55f, 0.0432f, 30.00f},
+  {8.04f, 0.02f, 0.0073f, 27.85f, 0.0451f, 30.00f},
+  {8.32f, 0.02f, 0.0077f, 28.15f, 0.0471f, 30.00f},
+  {8.59f, 0.03f, 0.0081f, 28.45f, 0.0490f, 30.00f},
+  {8.86f, 0.03f, 0.0085f, 28.75f, 0.0511f, 30.00f},
+  {9.13f, 0.03f, 0.0090f, 29.05f, 0.0531f, 30.00f},
+  {9.41f, 0.03f, 0.0094f, 29.35f, 0.0552f, 30.00f},
+  {9.68f, 0.03f, 0.0098f, 29.65f, 0.0572f, 30.00f},
+  {9.95f, 0.03f, 0.0102f, 29.95f, 0.0594f, 30.00f},
+  {10.25f, 0.04f, 0.0109f, 30.00f, 0.0611f, 0.00f},
+  {10.55f, 0.04f, 0.0116f, 30.00f, 0.0627f, 0.00f},
+  {10.85f, 0.05f, 0.0123f, 30.00f, 0.0643f, 0.00f},
+  {11.15f, 0.05f, 0.0131f, 30.00f, 0.0659f, 0.00f},
+  {11.45f, 0.06f, 0.0138f, 30.00f, 0.0675f, 0.00f},
+  {11.75f, 0.06f, 0.0145f, 30.00f, 0.0691f, 0.00f},
+  {12.05f, 0.07f, 0.0153f, 30.00f, 0.0707f, 0.00f},
+  {12.35f, 0.07f, 0.0160f, 30.00f, 0.0723f, 0.00f},
+  {12.65f, 0.08f, 0.0167f, 30.00f, 0.0739f, 0.00f},
+  {12.95f, 0.08f, 0.0175f, 30.00f, 0.0755f, 0.00f},
+  {13.25f, 0.09f, 0.0182f, 30.00f, 0.0771f, 0.00f},
+  {13.55f, 0.09f, 0.0189f, 30.00f, 0.0787f, 0.00f},
+  {13.85f, 0.10f, 0.0197f, 30.00f, 0.0803f, 0.00f},
+  {14.15f, 0.10f, 0.0204f, 30.00f, 0.0819f, 0.00f},
+  {14.45f, 0.11f, 0.0211f, 30.00f, 0.0836f, 0.00f},
+  {14.75f, 0.11f, 0.0219f, 30.00f, 0.0852f, 0.00f},
+  {15.05f, 0.12f, 0.0226f, 30.00f, 0.0868f, 0.00f},
+  {15.35f, 0.13f, 0.0236f, 30.00f, 0.0883f, 0.00f},
+  {15.65f, 0.13f, 0.0246f, 30.00f, 0.0898f, 0.00f},
+  {15.95f, 0.14f, 0.0256f, 30.00f, 0.0914f, 0.00f},
+  {16.25f, 0.15f, 0.0266f, 30.00f, 0.0929f, 0.00f},
+  {16.55f, 0.16f, 0.0276f, 30.00f, 0.0945f, 0.00f},
+  {16.85f, 0.17f, 0.0286f, 30.00f, 0.0960f, 0.00f},
+  {17.15f, 0.18f, 0.0296f, 30.00f, 0.0976f, 0.00f},
+  {17.45f, 0.19f, 0.0306f, 30.00f, 0.0991f, 0.00f},
+  {17.75f, 0.20f, 0.0316f, 30.00f, 0.1007f, 0.00f},
+  {18.05f, 0.21f, 0.0326f, 30.00f, 0.1022f, 0.00f},
+  {18.35f, 0.22f, 0.0336f, 30.00f, 0.1038f, 0.00f},
+  {18.64f, 0.23f, 0.0346f, 30.00f, 0.1053f, 0.00f},
+  {18.94f, 0.23f, 0.0356f, 30.00f, 0.1069f, 0.00f},
+  {19.24f, 0.24f, 0.0366f, 30.00f, 0.1084f, 0.00f},
+  {19.54f, 0.25f, 0.0376f, 30.00f, 0.1100f, 0.00f},
+  {19.84f, 0.26f, 0.0386f, 30.00f, 0.1115f, 0.00f},
+  {20.14f, 0.27f, 0.0397f, 30.00f, 0.1130f, 0.00f},
+  {20.44f, 0.29f, 0.0409f, 30.00f, 0.1145f, 0.00f},
+  {20.74f, 0.30f, 0.0422f, 30.00f, 0.1161f, 0.00f},
+  {21.04f, 0.32f, 0.0434f, 30.00f, 0.1176f, 0.00f},
+  {21.34f, 0.33f, 0.0447f, 30.00f, 0.1191f, 0.00f},
+  {21.64f, 0.35f, 0.0459f, 30.00f, 0.1206f, 0.00f},
+  {21.94f, 0.36f, 0.0472f, 30.00f, 0.1221f, 0.00f},
+  {22.24f, 0.38f, 0.0484f, 30.00f, 0.1236f, 0.00f},
+  {22.54f, 0.39f, 0.0497f, 30.00f, 0.1251f, 0.00f},
+  {22.84f, 0.41f, 0.0509f, 30.00f, 0.1266f, 0.00f},
+  {23.14f, 0.42f, 0.0522f, 30.00f, 0.1281f, 0.00f},
+  {23.44f, 0.44f, 0.0534f, 30.00f, 0.1296f, 0.00f},
+  {23.74f, 0.45f, 0.0547f, 30.00f, 0.1312f, 0.00f},
+  {24.04f, 0.47f, 0.0559f, 30.00f, 0.1327f, 0.00f},
+  {24.34f, 0.48f, 0.0572f, 30.00f, 0.1342f, 0.00f},
+  {24.64f, 0.50f, 0.0584f, 30.00f, 0.1357f, 0.00f},
+  {24.94f, 0.51f, 0.0597f, 30.00f, 0.1372f, 0.00f},
+  {25.24f, 0.53f, 0.0611f, 30.00f, 0.1387f, 0.00f},
+  {25.54f, 0.55f, 0.0626f, 30.00f, 0.1402f, 0.00f},
+  {25.84f, 0.57f, 0.0641f, 30.00f, 0.1416f, 0.00f},
+  {26.14f, 0.59f, 0.0656f, 30.00f, 0.1431f, 0.00f},
+  {26.43f, 0.62f, 0.0671f, 30.00f, 0.1446f, 0.00f},
+  {26.73f, 0.64f, 0.0686f, 30.00f, 0.1461f, 0.00f},
+  {27.03f, 0.66f, 0.0701f, 30.00f, 0.1475f, 0.00f},
+  {27.33f, 0.68f, 0.0716f, 30.00f, 0.1490f, 0.00f},
+  {27.63f, 0.70f, 0.0731f, 30.00f, 0.1505f, 0.00f},
+  {27.93f, 0.72f, 0.0746f, 30.00f, 0.1520f, 0.00f},
+  {28.23f, 0.75f, 0.0761f, 30.00f, 0.1534f, 0.00f},
+  {28.53f, 0.77f, 0.0776f, 30.00f, 0.1549f, 0.00f},
+  {28.83f, 0.79f, 0.0791f, 30.00f, 0.1564f, 0.00f},
+  {29.13f, 0.81f, 0.0806f, 30.00f, 0.1579f, 0.00f},
+  {29.43f, 0.83f, 0.0821f, 30.00f, 0.1594f, 0.00f},
+  {29.73f, 0.85f, 0.0836f, 30.00f, 0.1608f, 0.00f},
+  {30.02f, 0.88f, 0.0851f, 30.00f, 0.1623f, 0.00f},
+  {30.32f, 0.91f, 0.0869f, 30.00f, 0.1637f, 0.00f},
+  {30.62f, 0.94f, 0.0886f, 30.00f, 0.1651f, 0.00f},
+  {30.92f, 0.97f, 0.0903f, 30.00f, 0.1666f, 0.00f},
+  {31.22f, 1.00f, 0.0921f, 30.00f, 0.1680f, 0.00f},
+  {31.52f, 1.03f, 0.0938f, 30.00f, 0.1694f, 0.00f},
+  {31.82f, 1.05f, 0.0956f, 30.00f, 0.1708f, 0.00f},
+  {32.11f, 1.08f, 0.0973f, 30.00f, 0.1723f, 0.00f},
+  {32.41f, 1.11f, 0.0990f, 30.00f, 0.1737f, 0.00f},
+  {32.71f, 1.14f, 0.1008f, 30.00f, 0.1751f, 0.00f},
+  {33.01f, 1.17f, 0.1025f, 30.00f, 0.1765f, 0.00f},
+  {33.31f, 1.20f, 0.1043f, 30.00f, 0.1780f, 0.00f},
+  {33.61f, 1.23f, 0.1060f, 30.00f, 0.1794f, 0.00f},
+  {33.91f, 1.26f, 0.1077f, 30.00f, 0.1808f, 0.00f},
+  {34.20f, 1.29f, 0.1095f, 30.00f, 0.1822f, 0.00f},
+  {34.50f, 1.32f, 0.1112f, 30.00f, 0.1836f, 0.00f},
+  {34.80f, 1.35f, 0.1130f, 30.00f, 0.1851f, 0.00f},
+  {35.10f, 1.39f, 0.1148f, 30.00f, 0.1864f, -0.01f},
+  {35.40f, 1.42f, 0.1168f, 30.00f, 0.1878f, -0.01f},
+  {35.69f, 1.46f, 0.1188f, 30.00f, 0.1891f, -0.01f},
+  {35.99f, 1.50f, 0.1207f, 30.00f, 0.1904f, -0.01f},
+  {36.29f, 1.54f, 0.1227f, 30.00f, 0.1917f, -0.01f},
+  {36.59f, 1.58f, 0.1247f, 30.00f, 0.1931f, -0.01f},
+  {36.88f, 1.62f, 0.1266f, 30.00f, 0.1944f, -0.01f},
+  {37.18f, 1.66f, 0.1286f, 30.00f, 0.1957f, -0.01f},
+  {37.48f, 1.70f, 0.1306f, 30.00f, 0.1970f, -0.01f},
+  {37.78f, 1.74f, 0.1326f, 30.00f, 0.1984f, -0.01f},
+  {38.07f, 1.77f, 0.1345f, 30.00f, 0.1997f, -0.01f},
+  {38.37f, 1.81f, 0.1365f, 30.00f, 0.2010f, -0.01f},
+  {38.67f, 1.85f, 0.1385f, 30.00f, 0.2023f, -0.01f},
+  {38.97f, 1.89f, 0.1404f, 30.00f, 0.2037f, -0.01f},
+  {39.26f, 1.93f, 0.1424f, 30.00f, 0.2050f, -0.01f},
+  {39.56f, 1.97f, 0.1444f, 30.00f, 0.2063f, -0.01f},
+  {39.86f, 2.01f, 0.1463f, 30.00f, 0.2076f, -0.01f},
+  {40.15f, 2.05f, 0.1485f, 29.98f, 0.2087f, -1.93f},
+  {40.45f, 2.10f, 0.1506f, 29.96f, 0.2097f, -1.93f},
+  {40.74f, 2.15f, 0.1528f, 29.94f, 0.2107f, -1.93f},
+  {41.04f, 2.20f, 0.1550f, 29.92f, 0.2118f, -1.93f},
+  {41.33f, 2.25f, 0.1571f, 29.91f, 0.2128f, -1.93f},
+  {41.62f, 2.30f, 0.1593f, 29.89f, 0.2138f, -1.93f},
+  {41.92f, 2.35f, 0.1615f, 29.87f, 0.2148f, -1.93f},
+  {42.21f, 2.40f, 0.1636f, 29.85f, 0.2158f, -1.93f},
+  {42.51f, 2.45f, 0.1658f, 29.83f, 0.2168f, -1.93f},
+  {42.80f, 2.49f, 0.1680f, 29.81f, 0.2178f, -1.93f},
+  {43.10f, 2.54f, 0.1701f, 29.79f, 0.2188f, -1.93f},
+  {43.39f, 2.59f, 0.1723f, 29.77f, 0.2198f, -1.93f},
+  {43.68f, 2.64f, 0.1745f, 29.75f, 0.2208f, -1.93f},
+  {43.98f, 2.69f, 0.1766f, 29.73f, 0.2218f, -1.93f},
+  {44.27f, 2.74f, 0.1788f, 29.71f, 0.2228f, -1.93f},
+  {44.57f, 2.79f, 0.1810f, 29.69f, 0.2238f, -1.93f},
+  {44.86f, 2.84f, 0.1831f, 29.67f, 0.2248f, -1.45f},
+  {45.15f, 2.90f, 0.1855f, 29.66f, 0.2255f, -1.45f},
+  {45.44f, 2.96f, 0.1878f, 29.64f, 0.2263f, -1.45f},
+  {45.73f, 3.02f, 0.1901f, 29.63f, 0.2270f, -1.45f},
+  {46.02f, 3.08f, 0.1924f, 29.62f, 0.2278f, -1.45f},
+  {46.31f, 3.13f, 0.1947f, 29.60f, 0.2285f, -1.45f},
+  {46.60f, 3.19f, 0.1970f, 29.59f, 0.2293f, -1.45f},
+  {46.89f, 3.25f, 0.1994f, 29.57f, 0.2300f, -1.45f},
+  {47.18f, 3.31f, 0.2017f, 29.56f, 0.2308f, -1.45f},
+  {47.47f, 3.37f, 0.2040f, 29.54f, 0.2315f, -1.45f},
+  {47.76f, 3.43f, 0.2063f, 29.53f, 0.2323f, -1.45f},
+  {48.05f, 3.49f, 0.2086f, 29.51f, 0.2330f, -1.45f},
+  {48.34f, 3.55f, 0.2109f, 29.50f, 0.2338f, -1.45f},
+  {48.63f, 3.61f, 0.2132f, 29.49f, 0.2345f, -1.45f},
+  {48.91f, 3.67f, 0.2156f, 29.47f, 0.2353f, -1.45f},
+  {49.20f, 3.73f, 0.2179f, 29.46f, 0.2360f, -1.45f},
+  {49.49f, 3.79f, 0.2202f, 29.44f, 0.2368f, -1.45f},
+  {49.78f, 3.85f, 0.2225f, 29.43f, 0.2375f, -0.81f},
+  {50.07f, 3.92f, 0.2249f, 29.42f, 0.2379f, -0.81f},
+  {50.35f, 3.99f, 0.2274f, 29.41f, 0.2383f, -0.81f},
+  {50.64f, 4.06f, 0.2298f, 29.40f, 0.2387f, -0.81f},
+  {50.92f, 4.13f, 0.2322f, 29.40f, 0.2392f, -0.81f},
+  {51.21f, 4.20f, 0.2346f, 29.39f, 0.2396f, -0.81f},
+  {51.49f, 4.27f, 0.2370f, 29.38f, 0.2400f, -0.81f},
+  {51.78f, 4.34f, 0.2394f, 29.37f, 0.2404f, -0.81f},
+  {52.06f, 4.41f, 0.2418f, 29.36f, 0.2408f, -0.81f},
+  {52.35f, 4.48f, 0.2443f, 29.36f, 0.2413f, -0.81f},
+  {52.63f, 4.55f, 0.2467f, 29.35f, 0.2417f, -0.81f},
+  {52.92f, 4.62f, 0.2491f, 29.34f, 0.2421f, -0.81f},
+  {53.20f, 4.70f, 0.2515f, 29.33f, 0.2425f, -0.81f},
+  {53.49f, 4.77f, 0.2539f, 29.32f, 0.2429f, -0.81f},
+  {53.77f, 4.84f, 0.2563f, 29.32f, 0.2434f, -0.81f},
+  {54.06f, 4.91f, 0.2588f, 29.31f, 0.2438f, -0.81f},
+  {54.34f, 4.98f, 0.2612f, 29.30f, 0.2442f, -0.81f},
+  {54.63f, 5.05f, 0.2636f, 29.29f, 0.2446f, -0.01f},
+  {54.91f, 5.13f, 0.2661f, 29.29f, 0.2446f, -0.01f},
+  {55.19f, 5.21f, 0.2685f, 29.29f, 0.2446f, -0.01f},
+  {55.47f, 5.30f, 0.2710f, 29.29f, 0.2446f, -0.01f},
+  {55.75f, 5.38f, 0.2734f, 29.29f, 0.2446f, -0.01f},
+  {56.03f, 5.46f, 0.2759f, 29.29f, 0.2446f, -0.01f},
+  {56.31f, 5.54f, 0.2783f, 29.29f, 0.2446f, -0.01f},
+  {56.59f, 5.62f, 0.2808f, 29.29f, 0.2446f, -0.01f},
+  {56.88f, 5.71f, 0.2832f, 29.29f, 0.2446f, -0.01f},
+  {57.16f, 5.79f, 0.2857f, 29.29f, 0.2446f, -0.01f},
+  {57.44f, 5.87f, 0.2881f, 29.29f, 0.2446f, -0.01f},
+  {57.72f, 5.95f, 0.2906f, 29.29f, 0.2446f, -0.01f},
+  {58.00f, 6.03f, 0.2930f, 29.29f, 0.2446f, -0.01f},
+  {58.28f, 6.12f, 0.2955f, 29.29f, 0.2446f, -0.01f},
+  {58.56f, 6.20f, 0.2979f, 29.29f, 0.2446f, -0.01f},
+  {58.84f, 6.28f, 0.3004f, 29.29f, 0.2446f, -0.01f},
+  {59.12f, 6.36f, 0.3029f, 29.29f, 0.2446f, -0.01f},
+  {59.41f, 6.45f, 0.3053f, 29.29f, 0.2446f, 0.96f},
+  {59.68f, 6.54f, 0.3077f, 29.30f, 0.2441f, 0.96f},
+  {59.96f, 6.63f, 0.3101f, 29.31f, 0.2436f, 0.96f},
+  {60.24f, 6.73f, 0.3125f, 29.32f, 0.2431f, 0.96f},
+  {60.52f, 6.82f, 0.3150f, 29.33f, 0.2426f, 0.96f},
+  {60.80f, 6.92f, 0.3174f, 29.34f, 0.2421f, 0.96f},
+  {61.08f, 7.01f, 0.3198f, 29.35f, 0.2416f, 0.96f},
+  {61.35f, 7.10f, 0.3222f, 29.36f, 0.2411f, 0.96f},
+  {61.63f, 7.20f, 0.3246f, 29.37f, 0.2406f, 0.96f},
+  {61.91f, 7.29f, 0.3270f, 29.38f, 0.2401f, 0.96f},
+  {62.19f, 7.39f, 0.3294f, 29.39f, 0.2396f, 0.96f},
+  {62.47f, 7.48f, 0.3318f, 29.40f, 0.2391f, 0.96f},
+  {62.74f, 7.57f, 0.3343f, 29.41f, 0.2386f, 0.96f},
+  {63.02f, 7.67f, 0.3367f, 29.42f, 0.2381f, 0.96f},
+  {63.30f, 7.76f, 0.3391f, 29.43f, 0.2376f, 0.96f},
+  {63.58f, 7.86f, 0.3415f, 29.44f, 0.2371f, 0.96f},
+  {63.86f, 7.95f, 0.3439f, 29.45f, 0.2366f, 0.96f},
+  {64.14f, 8.04f, 0.3463f, 29.46f, 0.2361f, 2.07f},
+  {64.41f, 8.15f, 0.3486f, 29.48f, 0.2350f, 2.07f},
+  {64.69f, 8.26f, 0.3509f, 29.50f, 0.2340f, 2.07f},
+  {64.97f, 8.36f, 0.3532f, 29.52f, 0.2329f, 2.07f},
+  {65.24f, 8.47f, 0.3554f, 29.54f, 0.2318f, 2.07f},
+  {65.52f, 8.57f, 0.3577f, 29.56f, 0.2308f, 2.07f},
+  {65.80f, 8.68f, 0.3600f, 29.58f, 0.2297f, 2.07f},
+  {66.07f, 8.79f, 0.3623f, 29.60f, 0.2286f, 2.07f},
+  {66.35f, 8.89f, 0.3646f, 29.62f, 0.2276f, 2.07f},
+  {66.63f, 9.00f, 0.3668f, 29.64f, 0.2265f, 2.07f},
+  {66.90f, 9.10f, 0.3691f, 29.66f, 0.2254f, 2.07f},
+  {67.18f, 9.21f, 0.3714f, 29.68f, 0.2243f, 2.07f},
+  {67.46f, 9.32f, 0.3737f, 29.70f, 0.2232f, 2.07f},
+  {67.73f, 9.42f, 0.3760f, 29.72f, 0.2222f, 2.07f},
+  {68.01f, 9.53f, 0.3782f, 29.75f, 0.2211f, 2.07f},
+  {68.29f, 9.63f, 0.3805f, 29.77f, 0.2200f, 2.07f},
+  {68.56f, 9.74f, 0.3828f, 29.79f, 0.2189f, 2.07f},
+  {68.84f, 9.85f, 0.3850f, 29.81f, 0.2177f, 1.17f},
+  {69.11f, 9.97f, 0.3871f, 29.82f, 0.2159f, 1.17f},
+  {69.39f, 10.08f, 0.3891f, 29.83f, 0.2140f, 1.17f},
+  {69.66f, 10.20f, 0.3911f, 29.84f, 0.2122f, 1.17f},
+  {69.94f, 10.32f, 0.3932f, 29.85f, 0.2104f, 1.17f},
+  {70.22f, 10.43f, 0.3952f, 29.86f, 0.2086f, 1.17f},
+  {70.49f, 10.55f, 0.3973f, 29.88f, 0.2067f, 1.17f},
+  {70.77f, 10.67f, 0.3993f, 29.89f, 0.2049f, 1.17f},
+  {71.04f, 10.78f, 0.4013f, 29.90f, 0.2031f, 1.17f},
+  {71.32f, 10.90f, 0.4034f, 29.91f, 0.2012f, 1.17f},
+  {71.59f, 11.02f, 0.4054f, 29.92f, 0.1994f, 1.17f},
+  {71.87f, 11.14f, 0.4074f, 29.93f, 0.1975f, 1.17f},
+  {72.14f, 11.25f, 0.4095f, 29.95f, 0.1957f, 1.17f},
+  {72.42f, 11.37f, 0.4115f, 29.96f, 0.1939f, 1.17f},
+  {72.69f, 11.49f, 0.4135f, 29.97f, 0.1920f, 1.17f},
+  {72.97f, 11.60f, 0.4156f, 29.98f, 0.1902f, 1.17f},
+  {73.24f, 11.72f, 0.4176f, 29.99f, 0.1883f, 1.17f},
+  {73.52f, 11.84f, 0.4195f, 30.00f, 0.1862f, 0.00f},
+  {73.79f, 11.97f, 0.4212f, 30.00f, 0.1837f, 0.00f},
+  {74.06f, 12.09f, 0.4228f, 30.00f, 0.1812f, 0.00f},
+  {74.33f, 12.22f, 0.4245f, 30.00f, 0.1786f, 0.00f},
+  {74.60f, 12.35f, 0.4262f, 30.00f, 0.1761f, 0.00f},
+  {74.88f, 12.47f, 0.4278f, 30.00f, 0.1736f, 0.00f},
+  {75.15f, 12.60f, 0.4295f, 30.00f, 0.1711f, 0.00f},
+  {75.42f, 12.72f, 0.4312f, 30.00f, 0.1685f, 0.00f},
+  {75.69f, 12.85f, 0.4329f, 30.00f, 0.1660f, 0.00f},
+  {75.97f, 12.98f, 0.4345f, 30.00f, 0.1635f, 0.00f},
+  {76.24f, 13.10f, 0.4362f, 30.00f, 0.1610f, 0.00f},
+  {76.51f, 13.23f, 0.4379f, 30.00f, 0.1585f, 0.00f},
+  {76.78f, 13.35f, 0.4395f, 30.00f, 0.1559f, 0.00f},
+  {77.06f, 13.48f, 0.4412f, 30.00f, 0.1534f, 0.00f},
+  {77.33f, 13.60f, 0.4429f, 30.00f, 0.1509f, 0.00f},
+  {77.60f, 13.73f, 0.4445f, 30.00f, 0.1484f, 0.00f},
+  {77.87f, 13.86f, 0.4462f, 30.00f, 0.1459f, 0.00f},
+  {78.14f, 13.99f, 0.4475f, 30.00f, 0.1430f, 0.00f},
+  {78.41f, 14.12f, 0.4487f, 30.00f, 0.1400f, 0.00f},
+  {78.68f, 14.25f, 0.4499f, 30.00f, 0.1370f, 0.00f},
+  {78.95f, 14.39f, 0.4512f, 30.00f, 0.1340f, 0.00f},
+  {79.22f, 14.52f, 0.4524f, 30.00f, 0.1310f, 0.00f},
+  {79.49f, 14.65f, 0.4536f, 30.00f, 0.1280f, 0.00f},
+  {79.76f, 14.78f, 0.4548f, 30.00f, 0.1250f, 0.00f},
+  {80.03f, 14.92f, 0.4560f, 30.00f, 0.1220f, 0.00f},
+  {80.30f, 15.05f, 0.4572f, 30.00f, 0.1190f, 0.00f},
+  {80.56f, 15.18f, 0.4584f, 30.00f, 0.1160f, 0.00f},
+  {80.83f, 15.31f, 0.4596f, 30.00f, 0.1131f, 0.00f},
+  {81.10f, 15.44f, 0.4608f, 30.00f, 0.1101f, 0.00f},
+  {81.37f, 15.58f, 0.4620f, 30.00f, 0.1071f, 0.00f},
+  {81.64f, 15.71f, 0.4632f, 30.00f, 0.1041f, 0.00f},
+  {81.91f, 15.84f, 0.4645f, 30.00f, 0.1011f, 0.00f},
+  {82.18f, 15.97f, 0.4657f, 30.00f, 0.0981f, 0.00f},
+  {82.45f, 16.11f, 0.4668f, 30.00f, 0.0951f, 0.00f},
+  {82.72f, 16.24f, 0.4675f, 30.00f, 0.0918f, 0.00f},
+  {82.98f, 16.38f, 0.4682f, 30.00f, 0.0885f, 0.00f},
+  {83.25f, 16.52f, 0.4689f, 30.00f, 0.0852f, 0.00f},
+  {83.52f, 16.65f, 0.4695f, 30.00f, 0.0819f, 0.00f},
+  {83.78f, 16.79f, 0.4702f, 30.00f, 0.0785f, 0.00f},
+  {84.05f, 16.93f, 0.4709f, 30.00f, 0.0752f, 0.00f},
+  {84.32f, 17.06f, 0.4716f, 30.00f, 0.0719f, 0.00f},
+  {84.58f, 17.20f, 0.4723f, 30.00f, 0.0686f, 0.00f},
+  {84.85f, 17.34f, 0.4730f, 30.00f, 0.0653f, 0.00f},
+  {85.12f, 17.47f, 0.4736f, 30.00f, 0.0620f, 0.00f},
+  {85.39f, 17.61f, 0.4743f, 30.00f, 0.0587f, 0.00f},
+  {85.65f, 17.75f, 0.4750f, 30.00f, 0.0554f, 0.00f},
+  {85.92f, 17.89f, 0.4757f, 30.00f, 0.0521f, 0.00f},
+  {86.19f, 18.02f, 0.4764f, 30.00f, 0.0488f, 0.00f},
+  {86.45f, 18.16f, 0.4770f, 30.00f, 0.0455f, 0.00f},
+  {86.72f, 18.30f, 0.4777f, 30.00f, 0.0422f, 0.00f},
+  {86.99f, 18.43f, 0.4782f, 30.00f, 0.0388f, 0.00f},
+  {87.25f, 18.57f, 0.4783f, 30.00f, 0.0354f, 0.00f},
+  {87.52f, 18.71f, 0.4784f, 30.00f, 0.0320f, 0.00f},
+  {87.79f, 18.85f, 0.4785f, 30.00f, 0.0285f, 0.00f},
+  {88.05f, 18.99f, 0.4786f, 30.00f, 0.0251f, 0.00f},
+  {88.32f, 19.13f, 0.4788f, 30.00f, 0.0217f, 0.00f},
+  {88.58f, 19.26f, 0.4789f, 30.00f, 0.0182f, 0.00f},
+  {88.85f, 19.40f, 0.4790f, 30.00f, 0.0148f, 0.00f},
+  {89.12f, 19.54f, 0.4791f, 30.00f, 0.0114f, 0.00f},
+  {89.38f, 19.68f, 0.4792f, 30.00f, 0.0079f, 0.00f},
+  {89.65f, 19.82f, 0.4793f, 30.00f, 0.0045f, 0.00f},
+  {89.91f, 19.96f, 0.4795f, 30.00f, 0.0011f, 0.00f},
+  {90.18f, 20.09f, 0.4796f, 30.00f, -0.0024f, 0.00f},
+  {90.45f, 20.23f, 0.4797f, 30.00f, -0.0058f, 0.00f},
+  {90.71f, 20.37f, 0.4798f, 30.00f, -0.0093f, 0.00f},
+  {90.98f, 20.51f, 0.4799f, 30.00f, -0.0127f, 0.00f},
+  {91.25f, 20.65f, 0.4800f, 30.00f, -0.0161f, 0.00f},
+  {91.51f, 20.79f, 0.4797f, 30.00f, -0.0195f, 0.00f},
+  {91.78f, 20.92f, 0.4793f, 30.00f, -0.0229f, 0.00f},
+  {92.04f, 21.06f, 0.4788f, 30.00f, -0.0263f, 0.00f},
+  {92.31f, 21.20f, 0.4784f, 30.00f, -0.0297f, 0.00f},
+  {92.58f, 21.34f, 0.4779f, 30.00f, -0.0330f, 0.00f},
+  {92.84f, 21.48f, 0.4775f, 30.00f, -0.0364f, 0.00f},
+  {93.11f, 21.61f, 0.4770f, 30.00f, -0.0398f, 0.00f},
+  {93.38f, 21.75f, 0.4766f, 30.00f, -0.0432f, 0.00f},
+  {93.64f, 21.89f, 0.4761f, 30.00f, -0.0466f, 0.00f},
+  {93.91f, 22.03f, 0.4756f, 30.00f, -0.0499f, 0.00f},
+  {94.18f, 22.16f, 0.4752f, 30.00f, -0.0533f, 0.00f},
+  {94.44f, 22.30f, 0.4747f, 30.00f, -0.0567f, 0.00f},
+  {94.71f, 22.44f, 0.4743f, 30.00f, -0.0601f, 0.00f},
+  {94.98f, 22.58f, 0.4738f, 30.00f, -0.0635f, 0.00f},
+  {95.24f, 22.72f, 0.4734f, 30.00f, -0.0668f, 0.00f},
+  {95.51f, 22.85f, 0.4729f, 30.00f, -0.0702f, 0.00f},
+  {95.78f, 22.99f, 0.4724f, 30.00f, -0.0736f, 0.00f},
+  {96.04f, 23.13f, 0.4714f, 30.00f, -0.0767f, 0.00f},
+  {96.31f, 23.26f, 0.4704f, 30.00f, -0.0799f, 0.00f},
+  {96.58f, 23.39f, 0.4694f, 30.00f, -0.0830f, 0.00f},
+  {96.85f, 23.53f, 0.4684f, 30.00f, -0.0861f, 0.00f},
+  {97.12f, 23.66f, 0.4674f, 30.00f, -0.0893f, 0.00f},
+  {97.38f, 23.80f, 0.4664f, 30.00f, -0.0924f, 0.00f},
+  {97.65f, 23.93f, 0.4654f, 30.00f, -0.0956f, 0.00f},
+  {97.92f, 24.07f, 0.4644f, 30.00f, -0.0987f, 0.00f},
+  {98.19f, 24.20f, 0.4634f, 30.00f, -0.1018f, 0.00f},
+  {98.46f, 24.34f, 0.4624f, 30.00f, -0.1050f, 0.00f},
+  {98.73f, 24.47f, 0.4614f, 30.00f, -0.1081f, 0.00f},
+  {98.99f, 24.60f, 0.4604f, 30.00f, -0.1113f, 0.00f},
+  {99.26f, 24.74f, 0.4594f, 30.00f, -0.1144f, 0.00f},
+  {99.53f, 24.87f, 0.4584f, 30.00f, -0.1175f, 0.00f},
+  {99.80f, 25.01f, 0.4574f, 30.00f, -0.1207f, 0.00f},
+  {100.07f, 25.14f, 0.4564f, 30.00f, -0.1238f, 0.00f},
+  {100.34f, 25.27f, 0.4552f, 30.00f, -0.1268f, 0.00f},
+  {100.61f, 25.40f, 0.4537f, 30.00f, -0.1295f, 0.00f},
+  {100.88f, 25.53f, 0.4522f, 30.00f, -0.1323f, 0.00f},
+  {101.15f, 25.66f, 0.4508f, 30.00f, -0.1350f, 0.00f},
+  {101.42f, 25.79f, 0.4493f, 30.00f, -0.1377f, 0.00f},
+  {101.69f, 25.92f, 0.4478f, 30.00f, -0.1405f, 0.00f},
+  {101.96f, 26.05f, 0.4463f, 30.00f, -0.1432f, 0.00f},
+  {102.23f, 26.18f, 0.4448f, 30.00f, -0.1459f, 0.00f},
+  {102.50f, 26.31f, 0.4433f, 30.00f, -0.1487f, 0.00f},
+  {102.77f, 26.43f, 0.4418f, 30.00f, -0.1514f, 0.00f},
+  {103.04f, 26.56f, 0.4403f, 30.00f, -0.1541f, 0.00f},
+  {103.32f, 26.69f, 0.4388f, 30.00f, -0.1568f, 0.00f},
+  {103.59f, 26.82f, 0.4373f, 30.00f, -0.1596f, 0.00f},
+  {103.86f, 26.95f, 0.4359f, 30.00f, -0.1623f, 0.00f},
+  {104.13f, 27.08f, 0.4344f, 30.00f, -0.1650f, 0.00f},
+  {104.40f, 27.21f, 0.4329f, 30.00f, -0.1678f, 0.00f},
+  {104.67f, 27.34f, 0.4314f, 30.00f, -0.1705f, 0.00f},
+  {104.94f, 27.46f, 0.4296f, 30.00f, -0.1728f, 0.00f},
+  {105.22f, 27.58f, 0.4277f, 30.00f, -0.1750f, 0.00f},
+  {105.49f, 27.70f, 0.4258f, 30.00f, -0.1772f, 0.00f},
+  {105.77f, 27.82f, 0.4239f, 30.00f, -0.1794f, 0.00f},
+  {106.04f, 27.94f, 0.4220f, 30.00f, -0.1815f, 0.00f},
+  {106.32f, 28.07f, 0.4201f, 30.00f, -0.1837f, 0.00f},
+  {106.59f, 28.19f, 0.4182f, 30.00f, -0.1859f, 0.00f},
+  {106.86f, 28.31f, 0.4163f, 30.00f, -0.1881f, 0.00f},
+  {107.14f, 28.43f, 0.4144f, 30.00f, -0.1903f, 0.00f},
+  {107.41f, 28.55f, 0.4125f, 30.00f, -0.1925f, 0.00f},
+  {107.69f, 28.67f, 0.4106f, 30.00f, -0.1946f, 0.00f},
+  {107.96f, 28.79f, 0.4087f, 30.00f, -0.1968f, 0.00f},
+  {108.24f, 28.91f, 0.4068f, 30.00f, -0.1990f, 0.00f},
+  {108.51f, 29.03f, 0.4049f, 30.00f, -0.2012f, 0.00f},
+  {108.79f, 29.16f, 0.4029f, 30.00f, -0.2034f, 0.00f},
+  {109.06f, 29.28f, 0.4010f, 30.00f, -0.2056f, 0.00f},
+  {109.33f, 29.40f, 0.3991f, 30.00f, -0.2077f, -2.54f},
+  {109.61f, 29.51f, 0.3969f, 29.97f, -0.2090f, -2.54f},
+  {109.89f, 29.62f, 0.3947f, 29.95f, -0.2104f, -2.54f},
+  {110.16f, 29.73f, 0.3925f, 29.92f, -0.2117f, -2.54f},
+  {110.44f, 29.84f, 0.3903f, 29.90f, -0.2131f, -2.54f},
+  {110.72f, 29.95f, 0.3881f, 29.87f, -0.2144f, -2.54f},
+  {110.99f, 30.06f, 0.3859f, 29.85f, -0.2157f, -2.54f},
+  {111.27f, 30.17f, 0.3837f, 29.82f, -0.2171f, -2.54f},
+  {111.55f, 30.28f, 0.3815f, 29.79f, -0.2184f, -2.54f},
+  {111.82f, 30.39f, 0.3793f, 29.77f, -0.2197f, -2.54f},
+  {112.10f, 30.51f, 0.3771f, 29.74f, -0.2211f, -2.54f},
+  {112.38f, 30.62f, 0.3749f, 29.72f, -0.2224f, -2.54f},
+  {112.65f, 30.73f, 0.3727f, 29.69f, -0.2237f, -2.54f},
+  {112.93f, 30.84f, 0.3706f, 29.67f, -0.2250f, -2.54f},
+  {113.21f, 30.95f, 0.3684f, 29.64f, -0.2264f, -2.54f},
+  {113.48f, 31.06f, 0.3662f, 29.62f, -0.2277f, -2.54f},
+  {113.76f, 31.17f, 0.3640f, 29.59f, -0.2290f, -2.54f},
+  {114.04f, 31.28f, 0.3617f, 29.57f, -0.2301f, -1.40f},
+  {114.31f, 31.38f, 0.3593f, 29.56f, -0.2309f, -1.40f},
+  {114.59f, 31.48f, 0.3570f, 29.54f, -0.2316f, -1.40f},
+  {114.87f, 31.57f, 0.3546f, 29.53f, -0.2323f, -1.40f},
+  {115.14f, 31.67f, 0.3522f, 29.51f, -0.2331f, -1.40f},
+  {115.42f, 31.77f, 0.3499f, 29.50f, -0.2338f, -1.40f},
+  {115.70f, 31.87f, 0.3475f, 29.49f, -0.2345f, -1.40f},
+  {115.98f, 31.97f, 0.3451f, 29.47f, -0.2352f, -1.40f},
+  {116.25f, 32.07f, 0.3427f, 29.46f, -0.2360f, -1.40f},
+  {116.53f, 32.17f, 0.3404f, 29.44f, -0.2367f, -1.40f},
+  {116.81f, 32.27f, 0.3380f, 29.43f, -0.2374f, -1.40f},
+  {117.09f, 32.37f, 0.3356f, 29.42f, -0.2381f, -1.40f},
+  {117.36f, 32.46f, 0.3333f, 29.40f, -0.2389f, -1.40f},
+  {117.64f, 32.56f, 0.3309f, 29.39f, -0.2396f, -1.40f},
+  {117.92f, 32.66f, 0.3285f, 29.37f, -0.2403f, -1.40f},
+  {118.20f, 32.76f, 0.3262f, 29.36f, -0.2410f, -1.40f},
+  {118.47f, 32.86f, 0.3238f, 29.35f, -0.2418f, -1.40f},
+  {118.75f, 32.96f, 0.3214f, 29.34f, -0.2423f, -0.37f},
+  {119.03f, 33.04f, 0.3189f, 29.33f, -0.2425f, -0.37f},
+  {119.31f, 33.13f, 0.3165f, 29.33f, -0.2427f, -0.37f},
+  {119.59f, 33.22f, 0.3141f, 29.32f, -0.2429f, -0.37f},
+  {119.87f, 33.30f, 0.3116f, 29.32f, -0.2431f, -0.37f},
+  {120.15f, 33.39f, 0.3092f, 29.32f, -0.2433f, -0.37f},
+  {120.43f, 33.48f, 0.3067f, 29.31f, -0.2435f, -0.37f},
+  {120.71f, 33.56f, 0.3043f, 29.31f, -0.2437f, -0.37f},
+  {120.99f, 33.65f, 0.3018f, 29.31f, -0.2438f, -0.37f},
+  {121.27f, 33.74f, 0.2994f, 29.30f, -0.2440f, -0.37f},
+  {121.55f, 33.83f, 0.2969f, 29.30f, -0.2442f, -0.37f},
+  {121.83f, 33.91f, 0.2945f, 29.29f, -0.2444f, -0.37f},
+  {122.11f, 34.00f, 0.2920f, 29.29f, -0.2446f, -0.37f},
+  {122.39f, 34.09f, 0.2896f, 29.29f, -0.2448f, -0.37f},
+  {122.67f, 34.17f, 0.2871f, 29.28f, -0.2450f, -0.37f},
+  {122.95f, 34.26f, 0.2847f, 29.28f, -0.2452f, -0.37f},
+  {123.23f, 34.35f, 0.2822f, 29.28f, -0.2454f, -0.37f},
+  {123.51f, 34.43f, 0.2798f, 29.28f, -0.2455f, 0.50f},
+  {123.79f, 34.51f, 0.2774f, 29.28f, -0.2452f, 0.50f},
+  {124.08f, 34.58f, 0.2749f, 29.28f, -0.2449f, 0.50f},
+  {124.36f, 34.66f, 0.2725f, 29.29f, -0.2447f, 0.50f},
+  {124.64f, 34.73f, 0.2700f, 29.29f, -0.2444f, 0.50f},
+  {124.93f, 34.81f, 0.2676f, 29.30f, -0.2442f, 0.50f},
+  {125.21f, 34.88f, 0.2652f, 29.30f, -0.2439f, 0.50f},
+  {125.49f, 34.96f, 0.2627f, 29.31f, -0.2436f, 0.50f},
+  {125.78f, 35.03f, 0.2603f, 29.31f, -0.2434f, 0.50f},
+  {126.06f, 35.11f, 0.2578f, 29.32f, -0.2431f, 0.50f},
+  {126.34f, 35.18f, 0.2554f, 29.32f, -0.2429f, 0.50f},
+  {126.63f, 35.26f, 0.2530f, 29.33f, -0.2426f, 0.50f},
+  {126.91f, 35.33f, 0.2505f, 29.33f, -0.2423f, 0.50f},
+  {127.19f, 35.41f, 0.2481f, 29.34f, -0.2421f, 0.50f},
+  {127.48f, 35.48f, 0.2456f, 29.34f, -0.2418f, 0.50f},
+  {127.76f, 35.56f, 0.2432f, 29.35f, -0.2416f, 0.50f},
+  {128.04f, 35.63f, 0.2408f, 29.35f, -0.2413f, 0.50f},
+  {128.33f, 35.71f, 0.2383f, 29.36f, -0.2410f, 1.20f},
+  {128.62f, 35.77f, 0.2360f, 29.37f, -0.2403f, 1.20f},
+  {128.90f, 35.84f, 0.2336f, 29.39f, -0.2397f, 1.20f},
+  {129.19f, 35.90f, 0.2312f, 29.40f, -0.2391f, 1.20f},
+  {129.48f, 35.96f, 0.2289f, 29.41f, -0.2385f, 1.20f},
+  {129.77f, 36.03f, 0.2265f, 29.42f, -0.2379f, 1.20f},
+  {130.05f, 36.09f, 0.2242f, 29.43f, -0.2372f, 1.20f},
+  {130.34f, 36.15f, 0.2218f, 29.45f, -0.2366f, 1.20f},
+  {130.63f, 36.22f, 0.2194f, 29.46f, -0.2360f, 1.20f},
+  {130.92f, 36.28f, 0.2171f, 29.47f, -0.2354f, 1.20f},
+  {131.20f, 36.35f, 0.2147f, 29.48f, -0.2347f, 1.20f},
+  {131.49f, 36.41f, 0.2123f, 29.49f, -0.2341f, 1.20f},
+  {131.78f, 36.47f, 0.2100f, 29.51f, -0.2335f, 1.20f},
+  {132.07f, 36.54f, 0.2076f, 29.52f, -0.2328f, 1.20f},
+  {132.35f, 36.60f, 0.2052f, 29.53f, -0.2322f, 1.20f},
+  {132.64f, 36.67f, 0.2029f, 29.54f, -0.2316f, 1.20f},
+  {132.93f, 36.73f, 0.2005f, 29.55f, -0.2310f, 1.20f},
+  {133.22f, 36.79f, 0.1982f, 29.57f, -0.2303f, 1.75f},
+  {133.51f, 36.84f, 0.1960f, 29.58f, -0.2294f, 1.75f},
+  {133.80f, 36.90f, 0.1937f, 29.60f, -0.2285f, 1.75f},
+  {134.09f, 36.95f, 0.1915f, 29.62f, -0.2276f, 1.75f},
+  {134.39f, 37.00f, 0.1893f, 29.64f, -0.2267f, 1.75f},
+  {134.68f, 37.06f, 0.1870f, 29.66f, -0.2258f, 1.75f},
+  {134.97f, 37.11f, 0.1848f, 29.67f, -0.2248f, 1.75f},
+  {135.26f, 37.16f, 0.1826f, 29.69f, -0.2239f, 1.75f},
+  {135.56f, 37.22f, 0.1803f, 29.71f, -0.2230f, 1.75f},
+  {135.85f, 37.27f, 0.1781f, 29.73f, -0.2221f, 1.75f},
+  {136.14f, 37.32f, 0.1759f, 29.74f, -0.2212f, 1.75f},
+  {136.43f, 37.38f, 0.1736f, 29.76f, -0.2203f, 1.75f},
+  {136.73f, 37.43f, 0.1714f, 29.78f, -0.2194f, 1.75f},
+  {137.02f, 37.48f, 0.1692f, 29.80f, -0.2185f, 1.75f},
+  {137.31f, 37.53f, 0.1669f, 29.81f, -0.2176f, 1.75f},
+  {137.60f, 37.59f, 0.1647f, 29.83f, -0.2166f, 1.75f},
+  {137.89f, 37.64f, 0.1625f, 29.85f, -0.2157f, 1.75f},
+  {138.19f, 37.69f, 0.1603f, 29.86f, -0.2147f, 0.85f},
+  {138.49f, 37.73f, 0.1583f, 29.87f, -0.2135f, 0.85f},
+  {138.78f, 37.78f, 0.1562f, 29.88f, -0.2123f, 0.85f},
+  {139.08f, 37.82f, 0.1542f, 29.89f, -0.2111f, 0.85f},
+  {139.37f, 37.86f, 0.1521f, 29.90f, -0.2099f, 0.85f},
+  {139.67f, 37.90f, 0.1500f, 29.90f, -0.2087f, 0.85f},
+  {139.97f, 37.95f, 0.1480f, 29.91f, -0.2075f, 0.85f},
+  {140.26f, 37.99f, 0.1459f, 29.92f, -0.2063f, 0.85f},
+  {140.56f, 38.03f, 0.1439f, 29.93f, -0.2051f, 0.85f},
+  {140.85f, 38.08f, 0.1418f, 29.94f, -0.2039f, 0.85f},
+  {141.15f, 38.12f, 0.1398f, 29.95f, -0.2027f, 0.85f},
+  {141.45f, 38.16f, 0.1377f, 29.95f, -0.2015f, 0.85f},
+  {141.74f, 38.20f, 0.1357f, 29.96f, -0.2003f, 0.85f},
+  {142.04f, 38.25f, 0.1336f, 29.97f, -0.1991f, 0.85f},
+  {142.34f, 38.29f, 0.1316f, 29.98f, -0.1979f, 0.85f},
+  {142.63f, 38.33f, 0.1295f, 29.99f, -0.1967f, 0.85f},
+  {142.93f, 38.38f, 0.1275f, 30.00f, -0.1954f, 0.85f},
+  {143.23f, 38.41f, 0.1256f, 30.00f, -0.1941f, 0.00f},
+  {143.52f, 38.44f, 0.1237f, 30.00f, -0.1927f, 0.00f},
+  {143.82f, 38.48f, 0.1219f, 30.00f, -0.1913f, 0.00f},
+  {144.12f, 38.51f, 0.1200f, 30.00f, -0.1899f, 0.00f},
+  {144.42f, 38.54f, 0.1182f, 30.00f, -0.1885f, 0.00f},
+  {144.72f, 38.58f, 0.1164f, 30.00f, -0.1872f, 0.00f},
+  {145.01f, 38.61f, 0.1145f, 30.00f, -0.1858f, 0.00f},
+  {145.31f, 38.64f, 0.1127f, 30.00f, -0.1844f, 0.00f},
+  {145.61f, 38.68f, 0.1109f, 30.00f, -0.1830f, 0.00f},
+  {145.91f, 38.71f, 0.1090f, 30.00f, -0.1816f, 0.00f},
+  {146.21f, 38.74f, 0.1072f, 30.00f, -0.1802f, 0.00f},
+  {146.51f, 38.78f, 0.1054f, 30.00f, -0.1788f, 0.00f},
+  {146.80f, 38.81f, 0.1035f, 30.00f, -0.1774f, 0.00f},
+  {147.10f, 38.84f, 0.1017f, 30.00f, -0.1760f, 0.00f},
+  {147.40f, 38.88f, 0.0998f, 30.00f, -0.1746f, 0.00f},
+  {147.70f, 38.91f, 0.0980f, 30.00f, -0.1733f, 0.00f},
+  {148.00f, 38.94f, 0.0962f, 30.00f, -0.1719f, 0.00f},
+  {148.29f, 38.97f, 0.0946f, 30.00f, -0.1704f, 0.00f},
+  {148.59f, 38.99f, 0.0930f, 30.00f, -0.1689f, 0.00f},
+  {148.89f, 39.02f, 0.0914f, 30.00f, -0.1675f, 0.00f},
+  {149.19f, 39.04f, 0.0898f, 30.00f, -0.1660f, 0.00f},
+  {149.49f, 39.07f, 0.0882f, 30.00f, -0.1646f, 0.00f},
+  {149.79f, 39.09f, 0.0866f, 30.00f, -0.1631f, 0.00f},
+  {150.09f, 39.12f, 0.0850f, 30.00f, -0.1617f, 0.00f},
+  {150.39f, 39.14f, 0.0834f, 30.00f, -0.1602f, 0.00f},
+  {150.69f, 39.17f, 0.0818f, 30.00f, -0.1587f, 0.00f},
+  {150.99f, 39.19f, 0.0802f, 30.00f, -0.1573f, 0.00f},
+  {151.28f, 39.22f, 0.0786f, 30.00f, -0.1558f, 0.00f},
+  {151.58f, 39.24f, 0.0770f, 30.00f, -0.1544f, 0.00f},
+  {151.88f, 39.27f, 0.0754f, 30.00f, -0.1529f, 0.00f},
+  {152.18f, 39.29f, 0.0738f, 30.00f, -0.1514f, 0.00f},
+  {152.48f, 39.32f, 0.0722f, 30.00f, -0.1500f, 0.00f},
+  {152.78f, 39.34f, 0.0706f, 30.00f, -0.1485f, 0.00f},
+  {153.08f, 39.36f, 0.0691f, 30.00f, -0.1471f, 0.00f},
+  {153.38f, 39.38f, 0.0677f, 30.00f, -0.1456f, 0.00f},
+  {153.68f, 39.40f, 0.0664f, 30.00f, -0.1441f, 0.00f},
+  {153.98f, 39.41f, 0.0650f, 30.00f, -0.1426f, 0.00f},
+  {154.28f, 39.43f, 0.0637f, 30.00f, -0.1411f, 0.00f},
+  {154.58f, 39.45f, 0.0623f, 30.00f, -0.1396f, 0.00f},
+  {154.88f, 39.47f, 0.0610f, 30.00f, -0.1381f, 0.00f},
+  {155.18f, 39.48f, 0.0596f, 30.00f, -0.1366f, 0.00f},
+  {155.47f, 39.50f, 0.0583f, 30.00f, -0.1351f, 0.00f},
+  {155.77f, 39.52f, 0.0569f, 30.00f, -0.1336f, 0.00f},
+  {156.07f, 39.54f, 0.0556f, 30.00f, -0.1321f, 0.00f},
+  {156.37f, 39.55f, 0.0542f, 30.00f, -0.1306f, 0.00f},
+  {156.67f, 39.57f, 0.0529f, 30.00f, -0.1291f, 0.00f},
+  {156.97f, 39.59f, 0.0515f, 30.00f, -0.1276f, 0.00f},
+  {157.27f, 39.61f, 0.0502f, 30.00f, -0.1261f, 0.00f},
+  {157.57f, 39.62f, 0.0488f, 30.00f, -0.1246f, 0.00f},
+  {157.87f, 39.64f, 0.0475f, 30.00f, -0.1231f, 0.00f},
+  {158.17f, 39.65f, 0.0463f, 30.00f, -0.1216f, 0.00f},
+  {158.47f, 39.66f, 0.0452f, 30.00f, -0.1200f, 0.00f},
+  {158.77f, 39.68f, 0.0441f, 30.00f, -0.1185f, 0.00f},
+  {159.07f, 39.69f, 0.0430f, 30.00f, -0.1170f, 0.00f},
+  {159.37f, 39.70f, 0.0419f, 30.00f, -0.1155f, 0.00f},
+  {159.67f, 39.71f, 0.0408f, 30.00f, -0.1139f, 0.00f},
+  {159.97f, 39.72f, 0.0397f, 30.00f, -0.1124f, 0.00f},
+  {160.27f, 39.73f, 0.0386f, 30.00f, -0.1109f, 0.00f},
+  {160.57f, 39.74f, 0.0375f, 30.00f, -0.1093f, 0.00f},
+  {160.87f, 39.75f, 0.0364f, 30.00f, -0.1078f, 0.00f},
+  {161.17f, 39.77f, 0.0353f, 30.00f, -0.1063f, 0.00f},
+  {161.47f, 39.78f, 0.0342f, 30.00f, -0.1047f, 0.00f},
+  {161.77f, 39.79f, 0.0331f, 30.00f, -0.1032f, 0.00f},
+  {162.07f, 39.80f, 0.0320f, 30.00f, -0.1017f, 0.00f},
+  {162.37f, 39.81f, 0.0309f, 30.00f, -0.1002f, 0.00f},
+  {162.67f, 39.82f, 0.0298f, 30.00f, -0.0986f, 0.00f},
+  {162.97f, 39.83f, 0.0287f, 30.00f, -0.0971f, 0.00f},
+  {163.27f, 39.84f, 0.0279f, 30.00f, -0.0955f, 0.00f},
+  {163.57f, 39.85f, 0.0270f, 30.00f, -0.0939f, 0.00f},
+  {163.87f, 39.85f, 0.0262f, 30.00f, -0.0924f, 0.00f},
+  {164.17f, 39.86f, 0.0253f, 30.00f, -0.0908f, 0.00f},
+  {164.47f, 39.87f, 0.0245f, 30.00f, -0.0892f, 0.00f},
+  {164.77f, 39.87f, 0.0237f, 30.00f, -0.0876f, 0.00f},
+  {165.07f, 39.88f, 0.0228f, 30.00f, -0.0860f, 0.00f},
+  {165.37f, 39.88f, 0.0220f, 30.00f, -0.0845f, 0.00f},
+  {165.67f, 39.89f, 0.0211f, 30.00f, -0.0829f, 0.00f},
+  {165.97f, 39.90f, 0.0203f, 30.00f, -0.0813f, 0.00f},
+  {166.27f, 39.90f, 0.0195f, 30.00f, -0.0797f, 0.00f},
+  {166.57f, 39.91f, 0.0186f, 30.00f, -0.0782f, 0.00f},
+  {166.87f, 39.92f, 0.0178f, 30.00f, -0.0766f, 0.00f},
+  {167.17f, 39.92f, 0.0169f, 30.00f, -0.0750f, 0.00f},
+  {167.47f, 39.93f, 0.0161f, 30.00f, -0.0734f, 0.00f},
+  {167.77f, 39.94f, 0.0153f, 30.00f, -0.0718f, 0.00f},
+  {168.06f, 39.94f, 0.0145f, 29.98f, -0.0702f, -5.92f},
+  {168.36f, 39.94f, 0.0140f, 29.92f, -0.0684f, -5.92f},
+  {168.65f, 39.95f, 0.0134f, 29.86f, -0.0667f, -5.92f},
+  {168.95f, 39.95f, 0.0128f, 29.80f, -0.0649f, -5.92f},
+  {169.24f, 39.95f, 0.0123f, 29.74f, -0.0632f, -5.92f},
+  {169.54f, 39.95f, 0.0117f, 29.68f, -0.0614f, -5.92f},
+  {169.83f, 39.96f, 0.0111f, 29.62f, -0.0597f, -5.92f},
+  {170.13f, 39.96f, 0.0106f, 29.56f, -0.0580f, -5.92f},
+  {170.42f, 39.96f, 0.0100f, 29.50f, -0.0563f, -5.92f},
+  {170.72f, 39.97f, 0.0095f, 29.44f, -0.0545f, -5.92f},
+  {171.01f, 39.97f, 0.0089f, 29.39f, -0.0528f, -5.92f},
+  {171.31f, 39.97f, 0.0083f, 29.33f, -0.0511f, -5.92f},
+  {171.60f, 39.97f, 0.0078f, 29.27f, -0.0494f, -5.92f},
+  {171.90f, 39.98f, 0.0072f, 29.21f, -0.0477f, -5.92f},
+  {172.19f, 39.98f, 0.0066f, 29.15f, -0.0461f, -5.92f},
+  {172.49f, 39.98f, 0.0061f, 29.09f, -0.0444f, -5.92f},
+  {172.78f, 39.99f, 0.0055f, 29.03f, -0.0427f, -5.92f},
+  {173.05f, 39.99f, 0.0051f, 28.74f, -0.0409f, -59.49f},
+  {173.27f, 39.99f, 0.0049f, 28.14f, -0.0388f, -59.49f},
+  {173.49f, 39.99f, 0.0047f, 27.55f, -0.0367f, -59.49f},
+  {173.72f, 39.99f, 0.0045f, 26.95f, -0.0347f, -59.49f},
+  {173.94f, 39.99f, 0.0043f, 26.36f, -0.0328f, -59.49f},
+  {174.16f, 39.99f, 0.0041f, 25.76f, -0.0309f, -59.49f},
+  {174.39f, 39.99f, 0.0038f, 25.17f, -0.0290f, -59.49f},
+  {174.61f, 39.99f, 0.0036f, 24.57f, -0.0273f, -59.49f},
+  {174.83f, 39.99f, 0.0034f, 23.98f, -0.0255f, -59.49f},
+  {175.06f, 39.99f, 0.0032f, 23.38f, -0.0238f, -59.49f},
+  {175.28f, 39.99f, 0.0030f, 22.79f, -0.0222f, -59.49f},
+  {175.50f, 39.99f, 0.0028f, 22.19f, -0.0207f, -59.49f},
+  {175.73f, 39.99f, 0.0026f, 21.60f, -0.0191f, -59.49f},
+  {175.95f, 39.99f, 0.0024f, 21.01f, -0.0177f, -59.49f},
+  {176.18f, 40.00f, 0.0021f, 20.41f, -0.0163f, -59.49f},
+  {176.40f, 40.00f, 0.0019f, 19.82f, -0.0149f, -59.49f},
+  {176.62f, 40.00f, 0.0017f, 19.22f, -0.0136f, -59.49f},
+  {176.85f, 40.00f, 0.0015f, 18.63f, -0.0123f, -59.49f},
+  {177.07f, 40.00f, 0.0013f, 18.03f, -0.0111f, -59.49f},
+  {177.29f, 40.00f, 0.0011f, 17.44f, -0.0100f, -59.49f},
+  {177.52f, 40.00f, 0.0009f, 16.84f, -0.0089f, -59.49f},
+  {177.74f, 40.00f, 0.0007f, 16.25f, -0.0079f, -59.49f},
+  {177.95f, 40.00f, 0.0005f, 15.65f, -0.0069f, -60.00f},
+  {178.03f, 40.00f, 0.0004f, 15.05f, -0.0064f, -60.00f},
+  {178.11f, 40.00f, 0.0004f, 14.45f, -0.0059f, -60.00f},
+  {178.19f, 40.00f, 0.0004f, 13.85f, -0.0054f, -60.00f},
+  {178.27f, 40.00f, 0.0004f, 13.25f, -0.0049f, -60.00f},
+  {178.35f, 40.00f, 0.0004f, 12.65f, -0.0045f, -60.00f},
+  {178.43f, 40.00f, 0.0004f, 12.05f, -0.0041f, -60.00f},
+  {178.50f, 40.00f, 0.0003f, 11.45f, -0.0037f, -60.00f},
+  {178.58f, 40.00f, 0.0003f, 10.85f, -0.0033f, -60.00f},
+  {178.66f, 40.00f, 0.0003f, 10.25f, -0.0030f, -60.00f},
+  {178.74f, 40.00f, 0.0003f, 9.65f, -0.0026f, -60.00f},
+  {178.82f, 40.00f, 0.0003f, 9.05f, -0.0023f, -60.00f},
+  {178.90f, 40.00f, 0.0002f, 8.45f, -0.0020f, -60.00f},
+  {178.97f, 40.00f, 0.0002f, 7.85f, -0.0017f, -60.00f},
+  {179.05f, 40.00f, 0.0002f, 7.25f, -0.0015f, -60.00f},
+  {179.13f, 40.00f, 0.0002f, 6.65f, -0.0012f, -60.00f},
+  {179.21f, 40.00f, 0.0002f, 6.05f, -0.0010f, -60.00f},
+  {179.29f, 40.00f, 0.0002f, 5.45f, -0.0008f, -60.00f},
+  {179.37f, 40.00f, 0.0001f, 4.85f, -0.0007f, -60.00f},
+  {179.44f, 40.00f, 0.0001f, 4.25f, -0.0005f, -60.00f},
+  {179.52f, 40.00f, 0.0001f, 3.65f, -0.0004f, -60.00f},
+  {179.60f, 40.00f, 0.0001f, 3.05f, -0.0003f, -60.00f},
+  {179.68f, 40.00f, 0.0001f, 2.45f, -0.0002f, -60.00f},
+  {179.76f, 40.00f, 0.0001f, 1.85f, -0.0001f, -60.00f},
+  {179.84f, 40.00f, 0.0000f, 1.25f, -0.0000f, -60.00f},
+  {179.91f, 40.00f, 0.0000f, 0.65f, -0.0000f, -60.00f},
+  {179.99f, 40.00f, 0.0000f, 0.05f, -0.0000f, -60.00f},
+  {180.00f, 40.00f, 0.0000f, 0.00f, 0.0000f, 0.00f},
+};
+
+// cornerRight - x, y, theta, v, omega, a
+constexpr trajPoint cornerRight[CORNER_RIGHT_POINTS] = {
+  {0.00f, 0.00f, -0.0000f, 0.00f, -0.0000f, 60.00f},
+  {0.12f, -0.00f, -0.0000f, 0.60f, -0.0000f, 60.00f},
+  {0.24f, -0.00f, -0.0000f, 1.20f, -0.0000f, 60.00f},
+  {0.37f, -0.00f, -0.0000f, 1.80f, -0.0000f, 60.00f},
+  {0.49f, -0.00f, -0.0000f, 2.40f, -0.0000f, 60.00f},
+  {0.61f, -0.00f, -0.0000f, 3.00f, -0.0000f, 60.00f},
+  {0.73f, -0.00f, -0.0000f, 3.60f, -0.0000f, 60.00f},
+  {0.86f, -0.00f, -0.0000f, 4.20f, -0.0000f, 60.00f},
+  {0.98f, -0.00f, -0.0000f, 4.80f, -0.0000f, 60.00f},
+  {1.10f, -0.00f, -0.0000f, 5.40f, -0.0000f, 60.00f},
+  {1.22f, -0.00f, -0.0000f, 6.00f, -0.0000f, 60.00f},
+  {1.35f, -0.00f, -0.0000f, 6.60f, -0.0000f, 60.00f},
+  {1.47f, -0.00f, -0.0000f, 7.20f, -0.0000f, 60.00f},
+  {1.59f, -0.00f, -0.0000f, 7.80f, -0.0000f, 60.00f},
+  {1.71f, -0.00f, -0.0000f, 8.40f, -0.0000f, 60.00f},
+  {1.84f, -0.00f, -0.0000f, 9.00f, -0.0000f, 60.00f},
+  {1.96f, -0.00f, -0.0000f, 9.60f, -0.0000f, 60.00f},
+  {2.08f, -0.00f, -0.0000f, 10.20f, -0.0000f, 60.00f},
+  {2.20f, -0.00f, -0.0000f, 10.80f, -0.0000f, 60.00f},
+  {2.33f, -0.00f, -0.0000f, 11.40f, -0.0000f, 60.00f},
+  {2.45f, -0.00f, -0.0000f, 12.00f, -0.0000f, 60.00f},
+  {2.57f, -0.00f, -0.0000f, 12.60f, -0.0000f, 60.00f},
+  {2.69f, -0.00f, -0.0000f, 13.20f, -0.0000f, 60.00f},
+  {2.82f, -0.00f, -0.0000f, 13.80f, -0.0000f, 60.00f},
+  {2.94f, -0.00f, -0.0000f, 14.40f, -0.0000f, 60.00f},
+  {3.06f, -0.00f, -0.0000f, 15.00f, -0.0000f, 60.00f},
+  {3.18f, -0.00f, -0.0000f, 15.60f, -0.0000f, 60.00f},
+  {3.31f, -0.00f, -0.0000f, 16.20f, -0.0000f, 60.00f},
+  {3.43f, -0.00f, -0.0000f, 16.80f, -0.0000f, 60.00f},
+  {3.55f, -0.00f, -0.0000f, 17.40f, -0.0000f, 60.00f},
+  {3.67f, -0.00f, -0.0000f, 18.00f, -0.0000f, 60.00f},
+  {3.80f, -0.00f, -0.0000f, 18.60f, -0.0000f, 60.00f},
+  {3.92f, -0.00f, -0.0000f, 19.20f, -0.0000f, 60.00f},
+  {4.04f, -0.00f, -0.0000f, 19.80f, -0.0000f, 60.00f},
+  {4.16f, -0.00f, -0.0000f, 20.40f, -0.0000f, 60.00f},
+  {4.29f, -0.00f, -0.0000f, 21.00f, -0.0000f, 60.00f},
+  {4.41f, -0.00f, -0.0000f, 21.60f, -0.0000f, 60.00f},
+  {4.53f, -0.00f, -0.0000f, 22.20f, -0.0000f, 60.00f},
+  {4.65f, -0.00f, -0.0000f, 22.80f, -0.0000f, 60.00f},
+  {4.78f, -0.00f, -0.0000f, 23.40f, -0.0000f, 60.00f},
+  {4.90f, -0.00f, -0.0000f, 24.00f, -0.0000f, 60.00f},
+  {5.05f, -0.00f, -0.0000f, 24.55f, -0.0000f, 30.00f},
+  {5.32f, -0.00f, -0.0000f, 24.85f, -0.0000f, 30.00f},
+  {5.59f, -0.00f, -0.0000f, 25.15f, -0.0000f, 30.00f},
+  {5.87f, -0.00f, -0.0000f, 25.45f, -0.0000f, 30.00f},
+  {6.14f, -0.00f, -0.0000f, 25.75f, -0.0000f, 30.00f},
+  {6.41f, -0.00f, -0.0000f, 26.05f, -0.0000f, 30.00f},
+  {6.68f, -0.00f, -0.0000f, 26.35f, -0.0000f, 30.00f},
+  {6.95f, -0.00f, -0.0000f, 26.65f, -0.0000f, 30.00f},
+  {7.23f, -0.00f, -0.0000f, 26.95f, -0.0000f, 30.00f},
+  {7.50f, -0.00f, -0.0000f, 27.25f, -0.0000f, 30.00f},
+  {7.77f, -0.00f, -0.0000f, 27.55f, -0.0000f, 30.00f},
+  {8.04f, -0.00f, -0.0000f, 27.85f, -0.0000f, 30.00f},
+  {8.32f, -0.00f, -0.0000f, 28.15f, -0.0000f, 30.00f},
+  {8.59f, -0.00f, -0.0000f, 28.45f, -0.0000f, 30.00f},
+  {8.86f, -0.00f, -0.0000f, 28.75f, -0.0000f, 30.00f},
+  {9.13f, -0.00f, -0.0000f, 29.05f, -0.0000f, 30.00f},
+  {9.41f, -0.00f, -0.0000f, 29.35f, -0.0000f, 30.00f},
+  {9.68f, -0.00f, -0.0000f, 29.65f, -0.0000f, 30.00f},
+  {9.95f, -0.00f, -0.0000f, 29.95f, -0.0000f, 30.00f},
+  {10.25f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {10.55f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {10.85f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {11.15f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {11.45f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {11.75f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {12.05f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {12.35f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {12.65f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {12.95f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {13.25f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {13.55f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {13.85f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {14.15f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {14.45f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {14.75f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {15.05f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {15.35f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {15.65f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {15.95f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {16.25f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {16.55f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {16.85f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {17.15f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {17.45f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {17.75f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {18.05f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {18.35f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {18.65f, -0.00f, -0.0000f, 30.00f, -0.0000f, 0.00f},
+  {18.95f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {19.25f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {19.55f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {19.85f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {20.15f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {20.45f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {20.75f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {21.05f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {21.35f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {21.65f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {21.95f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {22.25f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {22.55f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {22.85f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {23.15f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {23.45f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {23.75f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {24.05f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {24.35f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {24.65f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {24.95f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {25.25f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {25.55f, -0.00f, -0.0000f, 30.00f, -0.0001f, 0.00f},
+  {25.85f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {26.15f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {26.45f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {26.75f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {27.05f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {27.35f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {27.65f, -0.00f, -0.0000f, 30.00f, -0.0002f, 0.00f},
+  {27.95f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {28.25f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {28.55f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {28.85f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {29.15f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {29.45f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {29.75f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {30.05f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {30.35f, -0.00f, -0.0001f, 30.00f, -0.0002f, 0.00f},
+  {30.65f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {30.95f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {31.25f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {31.55f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {31.85f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {32.15f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {32.45f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {32.75f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {33.05f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {33.35f, -0.00f, -0.0001f, 30.00f, -0.0003f, 0.00f},
+  {33.65f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {33.95f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {34.25f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {34.55f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {34.85f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {35.15f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {35.45f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {35.75f, -0.00f, -0.0001f, 30.00f, -0.0004f, 0.00f},
+  {36.05f, -0.00f, -0.0001f, 30.00f, -0.0005f, 0.00f},
+  {36.35f, -0.00f, -0.0001f, 30.00f, -0.0005f, 0.00f},
+  {36.65f, -0.00f, -0.0001f, 30.00f, -0.0005f, 0.00f},
+  {36.95f, -0.00f, -0.0001f, 30.00f, -0.0005f, 0.00f},
+  {37.25f, -0.00f, -0.0001f, 30.00f, -0.0005f, 0.00f},
+  {37.55f, -0.00f, -0.0002f, 30.00f, -0.0006f, 0.00f},
+  {37.85f, -0.00f, -0.0002f, 30.00f, -0.0006f, 0.00f},
+  {38.15f, -0.00f, -0.0002f, 30.00f, -0.0006f, 0.00f},
+  {38.45f, -0.00f, -0.0002f, 30.00f, -0.0006f, 0.00f},
+  {38.75f, -0.00f, -0.0002f, 30.00f, -0.0006f, 0.00f},
+  {39.05f, -0.00f, -0.0002f, 30.00f, -0.0006f, 0.00f},
+  {39.35f, -0.00f, -0.0002f, 30.00f, -0.0007f, 0.00f},
+  {39.65f, -0.00f, -0.0002f, 30.00f, -0.0007f, 0.00f},
+  {39.95f, -0.00f, -0.0002f, 30.00f, -0.0007f, 0.00f},
+  {40.25f, -0.00f, -0.0002f, 30.00f, -0.0007f, 0.00f},
+  {40.55f, -0.00f, -0.0002f, 30.00f, -0.0008f, 0.00f},
+  {40.85f, -0.00f, -0.0002f, 30.00f, -0.0008f, 0.00f},
+  {41.15f, -0.00f, -0.0002f, 30.00f, -0.0008f, 0.00f},
+  {41.45f, -0.00f, -0.0002f, 30.00f, -0.0009f, 0.00f},
+  {41.75f, -0.00f, -0.0002f, 30.00f, -0.0009f, 0.00f},
+  {42.05f, -0.00f, -0.0003f, 30.00f, -0.0009f, 0.00f},
+  {42.35f, -0.00f, -0.0003f, 30.00f, -0.0010f, 0.00f},
+  {42.65f, -0.00f, -0.0003f, 30.00f, -0.0010f, 0.00f},
+  {42.95f, -0.00f, -0.0003f, 30.00f, -0.0010f, 0.00f},
+  {43.25f, -0.00f, -0.0003f, 30.00f, -0.0011f, 0.00f},
+  {43.55f, -0.00f, -0.0003f, 30.00f, -0.0011f, 0.00f},
+  {43.85f, -0.00f, -0.0003f, 30.00f, -0.0011f, 0.00f},
+  {44.15f, -0.00f, -0.0003f, 30.00f, -0.0012f, 0.00f},
+  {44.45f, -0.00f, -0.0003f, 30.00f, -0.0012f, 0.00f},
+  {44.75f, -0.00f, -0.0003f, 30.00f, -0.0012f, 0.00f},
+  {45.05f, -0.00f, -0.0003f, 30.00f, -0.0013f, 0.00f},
+  {45.35f, -0.00f, -0.0004f, 30.00f, -0.0013f, 0.00f},
+  {45.65f, -0.00f, -0.0004f, 30.00f, -0.0014f, 0.00f},
+  {45.95f, -0.00f, -0.0004f, 30.00f, -0.0014f, 0.00f},
+  {46.25f, -0.00f, -0.0004f, 30.00f, -0.0015f, 0.00f},
+  {46.55f, -0.00f, -0.0004f, 30.00f, -0.0015f, 0.00f},
+  {46.85f, -0.00f, -0.0004f, 30.00f, -0.0016f, 0.00f},
+  {47.15f, -0.00f, -0.0005f, 30.00f, -0.0017f, 0.00f},
+  {47.45f, -0.00f, -0.0005f, 30.00f, -0.0017f, 0.00f},
+  {47.75f, -0.00f, -0.0005f, 30.00f, -0.0018f, 0.00f},
+  {48.05f, -0.00f, -0.0005f, 30.00f, -0.0018f, 0.00f},
+  {48.35f, -0.00f, -0.0005f, 30.00f, -0.0019f, 0.00f},
+  {48.65f, -0.00f, -0.0005f, 30.00f, -0.0020f, 0.00f},
+  {48.95f, -0.00f, -0.0006f, 30.00f, -0.0020f, 0.00f},
+  {49.25f, -0.00f, -0.0006f, 30.00f, -0.0021f, 0.00f},
+  {49.55f, -0.00f, -0.0006f, 30.00f, -0.0021f, 0.00f},
+  {49.85f, -0.01f, -0.0006f, 30.00f, -0.0022f, 0.00f},
+  {50.15f, -0.01f, -0.0006f, 30.00f, -0.0023f, 0.00f},
+  {50.45f, -0.01f, -0.0007f, 30.00f, -0.0024f, 0.00f},
+  {50.75f, -0.01f, -0.0007f, 30.00f, -0.0025f, 0.00f},
+  {51.05f, -0.01f, -0.0007f, 30.00f, -0.0026f, 0.00f},
+  {51.35f, -0.01f, -0.0007f, 30.00f, -0.0027f, 0.00f},
+  {51.65f, -0.01f, -0.0008f, 30.00f, -0.0028f, 0.00f},
+  {51.95f, -0.01f, -0.0008f, 30.00f, -0.0029f, 0.00f},
+  {52.25f, -0.01f, -0.0008f, 30.00f, -0.0030f, 0.00f},
+  {52.55f, -0.01f, -0.0009f, 30.00f, -0.0031f, 0.00f},
+  {52.85f, -0.01f, -0.0009f, 30.00f, -0.0032f, 0.00f},
+  {53.15f, -0.01f, -0.0009f, 30.00f, -0.0033f, 0.00f},
+  {53.45f, -0.01f, -0.0009f, 30.00f, -0.0034f, 0.00f},
+  {53.75f, -0.01f, -0.0010f, 30.00f, -0.0035f, 0.00f},
+  {54.05f, -0.01f, -0.0010f, 30.00f, -0.0036f, 0.00f},
+  {54.35f, -0.01f, -0.0010f, 30.00f, -0.0037f, 0.00f},
+  {54.65f, -0.01f, -0.0011f, 30.00f, -0.0038f, 0.00f},
+  {54.95f, -0.01f, -0.0011f, 30.00f, -0.0039f, 0.00f},
+  {55.25f, -0.01f, -0.0011f, 30.00f, -0.0041f, 0.00f},
+  {55.55f, -0.01f, -0.0012f, 30.00f, -0.0042f, 0.00f},
+  {55.85f, -0.01f, -0.0012f, 30.00f, -0.0044f, 0.00f},
+  {56.15f, -0.01f, -0.0013f, 30.00f, -0.0046f, 0.00f},
+  {56.45f, -0.01f, -0.0013f, 30.00f, -0.0048f, 0.00f},
+  {56.75f, -0.01f, -0.0014f, 30.00f, -0.0050f, 0.00f},
+  {57.05f, -0.01f, -0.0014f, 30.00f, -0.0051f, 0.00f},
+  {57.35f, -0.01f, -0.0015f, 30.00f, -0.0053f, 0.00f},
+  {57.65f, -0.01f, -0.0015f, 30.00f, -0.0055f, 0.00f},
+  {57.95f, -0.01f, -0.0016f, 30.00f, -0.0057f, 0.00f},
+  {58.25f, -0.01f, -0.0016f, 30.00f, -0.0059f, 0.00f},
+  {58.55f, -0.01f, -0.0017f, 30.00f, -0.0060f, 0.00f},
+  {58.85f, -0.01f, -0.0017f, 30.00f, -0.0062f, 0.00f},
+  {59.15f, -0.01f, -0.0018f, 30.00f, -0.0064f, 0.00f},
+  {59.45f, -0.02f, -0.0018f, 30.00f, -0.0066f, 0.00f},
+  {59.75f, -0.02f, -0.0019f, 30.00f, -0.0068f, 0.00f},
+  {60.05f, -0.02f, -0.0019f, 30.00f, -0.0070f, 0.00f},
+  {60.35f, -0.02f, -0.0020f, 30.00f, -0.0073f, 0.00f},
+  {60.65f, -0.02f, -0.0021f, 30.00f, -0.0076f, 0.00f},
+  {60.95f, -0.02f, -0.0022f, 30.00f, -0.0079f, 0.00f},
+  {61.25f, -0.02f, -0.0023f, 30.00f, -0.0082f, 0.00f},
+  {61.55f, -0.02f, -0.0024f, 30.00f, -0.0086f, 0.00f},
+  {61.85f, -0.02f, -0.0025f, 30.00f, -0.0089f, 0.00f},
+  {62.15f, -0.02f, -0.0025f, 30.00f, -0.0092f, 0.00f},
+  {62.45f, -0.02f, -0.0026f, 30.00f, -0.0095f, 0.00f},
+  {62.75f, -0.02f, -0.0027f, 30.00f, -0.0098f, 0.00f},
+  {63.05f, -0.02f, -0.0028f, 30.00f, -0.0102f, 0.00f},
+  {63.35f, -0.02f, -0.0029f, 30.00f, -0.0105f, 0.00f},
+  {63.65f, -0.02f, -0.0030f, 30.00f, -0.0108f, 0.00f},
+  {63.95f, -0.03f, -0.0031f, 30.00f, -0.0111f, 0.00f},
+  {64.25f, -0.03f, -0.0032f, 30.00f, -0.0114f, 0.00f},
+  {64.55f, -0.03f, -0.0033f, 30.00f, -0.0118f, 0.00f},
+  {64.85f, -0.03f, -0.0033f, 30.00f, -0.0121f, 0.00f},
+  {65.15f, -0.03f, -0.0035f, 30.00f, -0.0125f, 0.00f},
+  {65.45f, -0.03f, -0.0036f, 30.00f, -0.0131f, 0.00f},
+  {65.75f, -0.03f, -0.0038f, 30.00f, -0.0137f, 0.00f},
+  {66.05f, -0.03f, -0.0039f, 30.00f, -0.0142f, 0.00f},
+  {66.35f, -0.03f, -0.0041f, 30.00f, -0.0148f, 0.00f},
+  {66.65f, -0.04f, -0.0042f, 30.00f, -0.0154f, 0.00f},
+  {66.95f, -0.04f, -0.0044f, 30.00f, -0.0159f, 0.00f},
+  {67.25f, -0.04f, -0.0046f, 30.00f, -0.0165f, 0.00f},
+  {67.55f, -0.04f, -0.0047f, 30.00f, -0.0171f, 0.00f},
+  {67.85f, -0.04f, -0.0049f, 30.00f, -0.0176f, 0.00f},
+  {68.15f, -0.04f, -0.0050f, 30.00f, -0.0182f, 0.00f},
+  {68.45f, -0.04f, -0.0052f, 30.00f, -0.0188f, 0.00f},
+  {68.75f, -0.04f, -0.0053f, 30.00f, -0.0193f, 0.00f},
+  {69.05f, -0.05f, -0.0055f, 30.00f, -0.0199f, 0.00f},
+  {69.35f, -0.05f, -0.0057f, 30.00f, -0.0205f, 0.00f},
+  {69.65f, -0.05f, -0.0058f, 30.00f, -0.0210f, 0.00f},
+  {69.95f, -0.05f, -0.0060f, 30.00f, -0.0216f, 0.00f},
+  {70.25f, -0.05f, -0.0062f, 30.00f, -0.0225f, 0.00f},
+  {70.55f, -0.05f, -0.0065f, 30.00f, -0.0235f, 0.00f},
+  {70.85f, -0.06f, -0.0068f, 30.00f, -0.0245f, 0.00f},
+  {71.15f, -0.06f, -0.0071f, 30.00f, -0.0256f, 0.00f},
+  {71.45f, -0.06f, -0.0073f, 30.00f, -0.0266f, 0.00f},
+  {71.75f, -0.06f, -0.0076f, 30.00f, -0.0276f, 0.00f},
+  {72.05f, -0.07f, -0.0079f, 30.00f, -0.0286f, 0.00f},
+  {72.35f, -0.07f, -0.0082f, 30.00f, -0.0296f, 0.00f},
+  {72.65f, -0.07f, -0.0084f, 30.00f, -0.0306f, 0.00f},
+  {72.95f, -0.07f, -0.0087f, 30.00f, -0.0316f, 0.00f},
+  {73.25f, -0.07f, -0.0090f, 30.00f, -0.0326f, 0.00f},
+  {73.55f, -0.08f, -0.0093f, 30.00f, -0.0336f, 0.00f},
+  {73.85f, -0.08f, -0.0096f, 30.00f, -0.0346f, 0.00f},
+  {74.15f, -0.08f, -0.0098f, 30.00f, -0.0356f, 0.00f},
+  {74.45f, -0.08f, -0.0101f, 30.00f, -0.0366f, 0.00f},
+  {74.75f, -0.09f, -0.0104f, 30.00f, -0.0377f, 0.00f},
+  {75.05f, -0.09f, -0.0107f, 30.00f, -0.0388f, 0.00f},
+  {75.35f, -0.09f, -0.0112f, 30.00f, -0.0406f, 0.00f},
+  {75.65f, -0.10f, -0.0117f, 30.00f, -0.0425f, 0.00f},
+  {75.95f, -0.10f, -0.0122f, 30.00f, -0.0443f, 0.00f},
+  {76.25f, -0.11f, -0.0127f, 30.00f, -0.0461f, 0.00f},
+  {76.55f, -0.11f, -0.0132f, 30.00f, -0.0479f, 0.00f},
+  {76.85f, -0.11f, -0.0137f, 30.00f, -0.0497f, 0.00f},
+  {77.15f, -0.12f, -0.0142f, 30.00f, -0.0515f, 0.00f},
+  {77.45f, -0.12f, -0.0146f, 30.00f, -0.0533f, 0.00f},
+  {77.75f, -0.13f, -0.0151f, 30.00f, -0.0551f, 0.00f},
+  {78.05f, -0.13f, -0.0156f, 30.00f, -0.0569f, 0.00f},
+  {78.35f, -0.13f, -0.0161f, 30.00f, -0.0587f, 0.00f},
+  {78.65f, -0.14f, -0.0166f, 30.00f, -0.0605f, 0.00f},
+  {78.95f, -0.14f, -0.0171f, 30.00f, -0.0623f, 0.00f},
+  {79.25f, -0.15f, -0.0176f, 30.00f, -0.0641f, 0.00f},
+  {79.55f, -0.15f, -0.0181f, 30.00f, -0.0659f, 0.00f},
+  {79.85f, -0.15f, -0.0186f, 30.00f, -0.0677f, 0.00f},
+  {80.15f, -0.16f, -0.0193f, 30.00f, -0.0704f, 0.00f},
+  {80.45f, -0.17f, -0.0202f, 30.00f, -0.0736f, 0.00f},
+  {80.75f, -0.17f, -0.0211f, 30.00f, -0.0769f, 0.00f},
+  {81.05f, -0.18f, -0.0219f, 30.00f, -0.0801f, 0.00f},
+  {81.35f, -0.19f, -0.0228f, 30.00f, -0.0834f, 0.00f},
+  {81.65f, -0.20f, -0.0237f, 30.00f, -0.0866f, 0.00f},
+  {81.95f, -0.20f, -0.0246f, 30.00f, -0.0898f, 0.00f},
+  {82.25f, -0.21f, -0.0254f, 30.00f, -0.0931f, 0.00f},
+  {82.55f, -0.22f, -0.0263f, 30.00f, -0.0963f, 0.00f},
+  {82.85f, -0.22f, -0.0272f, 30.00f, -0.0996f, 0.00f},
+  {83.15f, -0.23f, -0.0281f, 30.00f, -0.1028f, 0.00f},
+  {83.45f, -0.24f, -0.0289f, 30.00f, -0.1061f, 0.00f},
+  {83.75f, -0.25f, -0.0298f, 30.00f, -0.1093f, 0.00f},
+  {84.05f, -0.25f, -0.0307f, 30.00f, -0.1126f, 0.00f},
+  {84.35f, -0.26f, -0.0316f, 30.00f, -0.1158f, 0.00f},
+  {84.65f, -0.27f, -0.0324f, 30.00f, -0.1190f, 0.00f},
+  {84.95f, -0.28f, -0.0334f, 30.00f, -0.1224f, -1.20f},
+  {85.24f, -0.29f, -0.0349f, 29.99f, -0.1282f, -1.20f},
+  {85.54f, -0.30f, -0.0365f, 29.98f, -0.1341f, -1.20f},
+  {85.84f, -0.31f, -0.0380f, 29.96f, -0.1399f, -1.20f},
+  {86.14f, -0.33f, -0.0396f, 29.95f, -0.1457f, -1.20f},
+  {86.44f, -0.34f, -0.0412f, 29.94f, -0.1515f, -1.20f},
+  {86.74f, -0.35f, -0.0427f, 29.93f, -0.1573f, -1.20f},
+  {87.04f, -0.36f, -0.0443f, 29.92f, -0.1631f, -1.20f},
+  {87.33f, -0.38f, -0.0459f, 29.90f, -0.1689f, -1.20f},
+  {87.63f, -0.39f, -0.0474f, 29.89f, -0.1747f, -1.20f},
+  {87.93f, -0.40f, -0.0490f, 29.88f, -0.1805f, -1.20f},
+  {88.23f, -0.42f, -0.0505f, 29.87f, -0.1863f, -1.20f},
+  {88.53f, -0.43f, -0.0521f, 29.86f, -0.1921f, -1.20f},
+  {88.83f, -0.44f, -0.0537f, 29.84f, -0.1978f, -1.20f},
+  {89.13f, -0.45f, -0.0552f, 29.83f, -0.2036f, -1.20f},
+  {89.43f, -0.47f, -0.0568f, 29.82f, -0.2094f, -1.20f},
+  {89.72f, -0.48f, -0.0584f, 29.81f, -0.2151f, -1.20f},
+  {90.02f, -0.50f, -0.0605f, 29.73f, -0.2225f, -15.64f},
+  {90.30f, -0.52f, -0.0632f, 29.57f, -0.2314f, -15.64f},
+  {90.58f, -0.54f, -0.0658f, 29.41f, -0.2403f, -15.64f},
+  {90.87f, -0.56f, -0.0685f, 29.26f, -0.2490f, -15.64f},
+  {91.15f, -0.58f, -0.0712f, 29.10f, -0.2576f, -15.64f},
+  {91.43f, -0.60f, -0.0739f, 28.94f, -0.2662f, -15.64f},
+  {91.72f, -0.63f, -0.0766f, 28.79f, -0.2746f, -15.64f},
+  {92.00f, -0.65f, -0.0792f, 28.63f, -0.2829f, -15.64f},
+  {92.29f, -0.67f, -0.0819f, 28.47f, -0.2911f, -15.64f},
+  {92.57f, -0.69f, -0.0846f, 28.32f, -0.2992f, -15.64f},
+  {92.85f, -0.71f, -0.0873f, 28.16f, -0.3071f, -15.64f},
+  {93.14f, -0.73f, -0.0900f, 28.00f, -0.3150f, -15.64f},
+  {93.42f, -0.75f, -0.0926f, 27.85f, -0.3228f, -15.64f},
+  {93.70f, -0.78f, -0.0953f, 27.69f, -0.3304f, -15.64f},
+  {93.99f, -0.80f, -0.0980f, 27.54f, -0.3380f, -15.64f},
+  {94.27f, -0.82f, -0.1007f, 27.38f, -0.3454f, -15.64f},
+  {94.56f, -0.84f, -0.1034f, 27.22f, -0.3528f, -15.64f},
+  {94.83f, -0.87f, -0.1064f, 27.08f, -0.3595f, -8.46f},
+  {95.09f, -0.90f, -0.1109f, 27.00f, -0.3642f, -8.46f},
+  {95.36f, -0.94f, -0.1154f, 26.91f, -0.3689f, -8.46f},
+  {95.62f, -0.97f, -0.1199f, 26.83f, -0.3736f, -8.46f},
+  {95.88f, -1.01f, -0.1244f, 26.74f, -0.3782f, -8.46f},
+  {96.14f, -1.04f, -0.1289f, 26.66f, -0.3827f, -8.46f},
+  {96.40f, -1.08f, -0.1334f, 26.57f, -0.3872f, -8.46f},
+  {96.66f, -1.11f, -0.1379f, 26.49f, -0.3917f, -8.46f},
+  {96.92f, -1.15f, -0.1423f, 26.40f, -0.3962f, -8.46f},
+  {97.18f, -1.19f, -0.1468f, 26.32f, -0.4006f, -8.46f},
+  {97.44f, -1.22f, -0.1513f, 26.23f, -0.4050f, -8.46f},
+  {97.70f, -1.26f, -0.1558f, 26.15f, -0.4093f, -8.46f},
+  {97.96f, -1.29f, -0.1603f, 26.06f, -0.4136f, -8.46f},
+  {98.22f, -1.33f, -0.1648f, 25.98f, -0.4179f, -8.46f},
+  {98.48f, -1.36f, -0.1693f, 25.90f, -0.4221f, -8.46f},
+  {98.74f, -1.40f, -0.1738f, 25.81f, -0.4263f, -8.46f},
+  {99.01f, -1.43f, -0.1783f, 25.73f, -0.4305f, -8.46f},
+  {99.27f, -1.47f, -0.1828f, 25.64f, -0.4346f, -8.46f},
+  {99.53f, -1.50f, -0.1873f, 25.56f, -0.4387f, -8.46f},
+  {99.78f, -1.56f, -0.1918f, 25.58f, -0.4377f, 7.51f},
+  {100.04f, -1.62f, -0.1964f, 25.65f, -0.4341f, 7.51f},
+  {100.29f, -1.68f, -0.2010f, 25.73f, -0.4304f, 7.51f},
+  {100.55f, -1.75f, -0.2055f, 25.80f, -0.4266f, 7.51f},
+  {100.80f, -1.81f, -0.2101f, 25.88f, -0.4229f, 7.51f},
+  {101.06f, -1.87f, -0.2146f, 25.95f, -0.4191f, 7.51f},
+  {101.31f, -1.94f, -0.2192f, 26.03f, -0.4153f, 7.51f},
+  {101.57f, -2.00f, -0.2238f, 26.10f, -0.4114f, 7.51f},
+  {101.82f, -2.06f, -0.2283f, 26.18f, -0.4076f, 7.51f},
+  {102.07f, -2.13f, -0.2329f, 26.25f, -0.4037f, 7.51f},
+  {102.33f, -2.19f, -0.2375f, 26.33f, -0.3997f, 7.51f},
+  {102.58f, -2.25f, -0.2420f, 26.40f, -0.3958f, 7.51f},
+  {102.84f, -2.31f, -0.2466f, 26.48f, -0.3918f, 7.51f},
+  {103.09f, -2.38f, -0.2511f, 26.55f, -0.3878f, 7.51f},
+  {103.35f, -2.44f, -0.2557f, 26.63f, -0.3837f, 7.51f},
+  {103.60f, -2.50f, -0.2603f, 26.70f, -0.3796f, 7.51f},
+  {103.86f, -2.57f, -0.2648f, 26.78f, -0.3755f, 7.51f},
+  {104.11f, -2.63f, -0.2694f, 26.85f, -0.3714f, 7.51f},
+  {104.37f, -2.70f, -0.2737f, 26.94f, -0.3668f, 15.15f},
+  {104.64f, -2.78f, -0.2765f, 27.09f, -0.3597f, 15.15f},
+  {104.91f, -2.86f, -0.2793f, 27.25f, -0.3526f, 15.15f},
+  {105.18f, -2.95f, -0.2821f, 27.40f, -0.3453f, 15.15f},
+  {105.45f, -3.03f, -0.2849f, 27.55f, -0.3379f, 15.15f},
+  {105.71f, -3.12f, -0.2877f, 27.70f, -0.3305f, 15.15f},
+  {105.98f, -3.20f, -0.2905f, 27.85f, -0.3229f, 15.15f},
+  {106.25f, -3.29f, -0.2933f, 28.00f, -0.3152f, 15.15f},
+  {106.52f, -3.37f, -0.2961f, 28.15f, -0.3075f, 15.15f},
+  {106.79f, -3.46f, -0.2989f, 28.31f, -0.2996f, 15.15f},
+  {107.06f, -3.54f, -0.3017f, 28.46f, -0.2916f, 15.15f},
+  {107.33f, -3.62f, -0.3045f, 28.61f, -0.2835f, 15.15f},
+  {107.60f, -3.71f, -0.3073f, 28.76f, -0.2754f, 15.15f},
+  {107.87f, -3.79f, -0.3101f, 28.91f, -0.2671f, 15.15f},
+  {108.14f, -3.88f, -0.3130f, 29.06f, -0.2587f, 15.15f},
+  {108.41f, -3.96f, -0.3158f, 29.21f, -0.2502f, 15.15f},
+  {108.68f, -4.05f, -0.3186f, 29.37f, -0.2416f, 15.15f},
+  {108.95f, -4.13f, -0.3214f, 29.52f, -0.2329f, 15.15f},
+  {109.23f, -4.23f, -0.3231f, 29.55f, -0.2274f, 2.92f},
+  {109.51f, -4.33f, -0.3249f, 29.58f, -0.2219f, 2.92f},
+  {109.79f, -4.43f, -0.3266f, 29.61f, -0.2165f, 2.92f},
+  {110.07f, -4.53f, -0.3283f, 29.64f, -0.2110f, 2.92f},
+  {110.35f, -4.63f, -0.3301f, 29.67f, -0.2056f, 2.92f},
+  {110.63f, -4.72f, -0.3318f, 29.70f, -0.2001f, 2.92f},
+  {110.91f, -4.82f, -0.3335f, 29.73f, -0.1946f, 2.92f},
+  {111.19f, -4.92f, -0.3353f, 29.76f, -0.1891f, 2.92f},
+  {111.47f, -5.02f, -0.3370f, 29.78f, -0.1836f, 2.92f},
+  {111.75f, -5.12f, -0.3387f, 29.81f, -0.1781f, 2.92f},
+  {112.03f, -5.22f, -0.3405f, 29.84f, -0.1725f, 2.92f},
+  {112.31f, -5.32f, -0.3422f, 29.87f, -0.1670f, 2.92f},
+  {112.59f, -5.42f, -0.3439f, 29.90f, -0.1614f, 2.92f},
+  {112.87f, -5.52f, -0.3457f, 29.93f, -0.1558f, 2.92f},
+  {113.16f, -5.62f, -0.3474f, 29.96f, -0.1503f, 2.92f},
+  {113.44f, -5.71f, -0.3491f, 29.99f, -0.1447f, 2.92f},
+  {113.72f, -5.82f, -0.3505f, 30.00f, -0.1408f, 0.00f},
+  {114.00f, -5.92f, -0.3516f, 30.00f, -0.1380f, 0.00f},
+  {114.28f, -6.03f, -0.3527f, 30.00f, -0.1352f, 0.00f},
+  {114.56f, -6.13f, -0.3538f, 30.00f, -0.1325f, 0.00f},
+  {114.84f, -6.24f, -0.3549f, 30.00f, -0.1297f, 0.00f},
+  {115.12f, -6.35f, -0.3560f, 30.00f, -0.1269f, 0.00f},
+  {115.40f, -6.45f, -0.3571f, 30.00f, -0.1241f, 0.00f},
+  {115.68f, -6.56f, -0.3582f, 30.00f, -0.1213f, 0.00f},
+  {115.96f, -6.66f, -0.3593f, 30.00f, -0.1186f, 0.00f},
+  {116.24f, -6.77f, -0.3604f, 30.00f, -0.1158f, 0.00f},
+  {116.52f, -6.88f, -0.3615f, 30.00f, -0.1130f, 0.00f},
+  {116.80f, -6.98f, -0.3626f, 30.00f, -0.1102f, 0.00f},
+  {117.09f, -7.09f, -0.3637f, 30.00f, -0.1074f, 0.00f},
+  {117.37f, -7.19f, -0.3648f, 30.00f, -0.1047f, 0.00f},
+  {117.65f, -7.30f, -0.3659f, 30.00f, -0.1019f, 0.00f},
+  {117.93f, -7.40f, -0.3670f, 30.00f, -0.0991f, 0.00f},
+  {118.21f, -7.51f, -0.3680f, 30.00f, -0.0971f, 0.00f},
+  {118.49f, -7.62f, -0.3689f, 30.00f, -0.0964f, 0.00f},
+  {118.77f, -7.73f, -0.3697f, 30.00f, -0.0956f, 0.00f},
+  {119.05f, -7.84f, -0.3706f, 30.00f, -0.0949f, 0.00f},
+  {119.32f, -7.95f, -0.3714f, 30.00f, -0.0942f, 0.00f},
+  {119.60f, -8.06f, -0.3723f, 30.00f, -0.0934f, 0.00f},
+  {119.88f, -8.17f, -0.3731f, 30.00f, -0.0927f, 0.00f},
+  {120.16f, -8.28f, -0.3739f, 30.00f, -0.0919f, 0.00f},
+  {120.44f, -8.39f, -0.3748f, 30.00f, -0.0912f, 0.00f},
+  {120.72f, -8.50f, -0.3756f, 30.00f, -0.0905f, 0.00f},
+  {121.00f, -8.61f, -0.3765f, 30.00f, -0.0897f, 0.00f},
+  {121.28f, -8.72f, -0.3773f, 30.00f, -0.0890f, 0.00f},
+  {121.56f, -8.83f, -0.3782f, 30.00f, -0.0882f, 0.00f},
+  {121.84f, -8.94f, -0.3790f, 30.00f, -0.0875f, 0.00f},
+  {122.12f, -9.05f, -0.3798f, 30.00f, -0.0868f, 0.00f},
+  {122.40f, -9.16f, -0.3807f, 30.00f, -0.0860f, 0.00f},
+  {122.67f, -9.27f, -0.3815f, 30.00f, -0.0856f, 0.00f},
+  {122.95f, -9.38f, -0.3824f, 30.00f, -0.0867f, 0.00f},
+  {123.23f, -9.50f, -0.3833f, 30.00f, -0.0877f, 0.00f},
+  {123.51f, -9.61f, -0.3841f, 30.00f, -0.0888f, 0.00f},
+  {123.79f, -9.72f, -0.3850f, 30.00f, -0.0899f, 0.00f},
+  {124.06f, -9.84f, -0.3859f, 30.00f, -0.0910f, 0.00f},
+  {124.34f, -9.95f, -0.3867f, 30.00f, -0.0920f, 0.00f},
+  {124.62f, -10.06f, -0.3876f, 30.00f, -0.0931f, 0.00f},
+  {124.90f, -10.18f, -0.3885f, 30.00f, -0.0942f, 0.00f},
+  {125.17f, -10.29f, -0.3893f, 30.00f, -0.0953f, 0.00f},
+  {125.45f, -10.41f, -0.3902f, 30.00f, -0.0963f, 0.00f},
+  {125.73f, -10.52f, -0.3911f, 30.00f, -0.0974f, 0.00f},
+  {126.01f, -10.63f, -0.3919f, 30.00f, -0.0985f, 0.00f},
+  {126.28f, -10.75f, -0.3928f, 30.00f, -0.0996f, 0.00f},
+  {126.56f, -10.86f, -0.3937f, 30.00f, -0.1006f, 0.00f},
+  {126.84f, -10.97f, -0.3945f, 30.00f, -0.1017f, 0.00f},
+  {127.12f, -11.09f, -0.3954f, 30.00f, -0.1028f, 0.00f},
+  {127.39f, -11.20f, -0.3966f, 30.00f, -0.1060f, 0.00f},
+  {127.67f, -11.32f, -0.3978f, 30.00f, -0.1094f, 0.00f},
+  {127.95f, -11.44f, -0.3989f, 30.00f, -0.1128f, 0.00f},
+  {128.22f, -11.56f, -0.4001f, 30.00f, -0.1161f, 0.00f},
+  {128.50f, -11.67f, -0.4013f, 30.00f, -0.1195f, 0.00f},
+  {128.77f, -11.79f, -0.4025f, 30.00f, -0.1228f, 0.00f},
+  {129.05f, -11.91f, -0.4037f, 30.00f, -0.1262f, 0.00f},
+  {129.33f, -12.03f, -0.4049f, 30.00f, -0.1295f, 0.00f},
+  {129.60f, -12.14f, -0.4061f, 30.00f, -0.1329f, 0.00f},
+  {129.88f, -12.26f, -0.4073f, 30.00f, -0.1363f, 0.00f},
+  {130.15f, -12.38f, -0.4085f, 30.00f, -0.1396f, 0.00f},
+  {130.43f, -12.50f, -0.4097f, 30.00f, -0.1430f, 0.00f},
+  {130.71f, -12.62f, -0.4109f, 30.00f, -0.1463f, 0.00f},
+  {130.98f, -12.73f, -0.4120f, 30.00f, -0.1497f, 0.00f},
+  {131.26f, -12.85f, -0.4132f, 30.00f, -0.1531f, 0.00f},
+  {131.53f, -12.97f, -0.4144f, 30.00f, -0.1564f, 0.00f},
+  {131.80f, -13.09f, -0.4162f, 29.95f, -0.1625f, -6.35f},
+  {132.07f, -13.21f, -0.4181f, 29.88f, -0.1691f, -6.35f},
+  {132.34f, -13.33f, -0.4201f, 29.82f, -0.1757f, -6.35f},
+  {132.61f, -13.46f, -0.4220f, 29.76f, -0.1823f, -6.35f},
+  {132.88f, -13.58f, -0.4239f, 29.69f, -0.1888f, -6.35f},
+  {133.15f, -13.70f, -0.4258f, 29.63f, -0.1953f, -6.35f},
+  {133.41f, -13.82f, -0.4277f, 29.57f, -0.2018f, -6.35f},
+  {133.68f, -13.94f, -0.4296f, 29.50f, -0.2082f, -6.35f},
+  {133.95f, -14.06f, -0.4316f, 29.44f, -0.2147f, -6.35f},
+  {134.22f, -14.19f, -0.4335f, 29.38f, -0.2210f, -6.35f},
+  {134.49f, -14.31f, -0.4354f, 29.31f, -0.2274f, -6.35f},
+  {134.76f, -14.43f, -0.4373f, 29.25f, -0.2337f, -6.35f},
+  {135.02f, -14.55f, -0.4392f, 29.19f, -0.2400f, -6.35f},
+  {135.29f, -14.67f, -0.4412f, 29.12f, -0.2463f, -6.35f},
+  {135.56f, -14.80f, -0.4431f, 29.06f, -0.2525f, -6.35f},
+  {135.83f, -14.92f, -0.4450f, 28.99f, -0.2587f, -6.35f},
+  {136.09f, -15.04f, -0.4476f, 28.86f, -0.2675f, -18.33f},
+  {136.33f, -15.16f, -0.4508f, 28.68f, -0.2782f, -18.33f},
+  {136.57f, -15.29f, -0.4539f, 28.50f, -0.2888f, -18.33f},
+  {136.82f, -15.41f, -0.4571f, 28.31f, -0.2992f, -18.33f},
+  {137.06f, -15.53f, -0.4603f, 28.13f, -0.3095f, -18.33f},
+  {137.31f, -15.66f, -0.4635f, 27.95f, -0.3196f, -18.33f},
+  {137.55f, -15.78f, -0.4666f, 27.76f, -0.3295f, -18.33f},
+  {137.80f, -15.90f, -0.4698f, 27.58f, -0.3393f, -18.33f},
+  {138.04f, -16.02f, -0.4730f, 27.40f, -0.3489f, -18.33f},
+  {138.29f, -16.15f, -0.4762f, 27.21f, -0.3583f, -18.33f},
+  {138.53f, -16.27f, -0.4793f, 27.03f, -0.3676f, -18.33f},
+  {138.78f, -16.39f, -0.4825f, 26.85f, -0.3768f, -18.33f},
+  {139.02f, -16.52f, -0.4857f, 26.67f, -0.3858f, -18.33f},
+  {139.27f, -16.64f, -0.4888f, 26.48f, -0.3946f, -18.33f},
+  {139.51f, -16.76f, -0.4920f, 26.30f, -0.4032f, -18.33f},
+  {139.76f, -16.89f, -0.4952f, 26.12f, -0.4118f, -18.33f},
+  {140.00f, -17.01f, -0.4984f, 25.93f, -0.4201f, -18.33f},
+  {140.23f, -17.13f, -0.5020f, 25.74f, -0.4301f, -22.85f},
+  {140.44f, -17.25f, -0.5071f, 25.51f, -0.4450f, -22.85f},
+  {140.64f, -17.37f, -0.5122f, 25.28f, -0.4596f, -22.85f},
+  {140.84f, -17.49f, -0.5173f, 25.05f, -0.4739f, -22.85f},
+  {141.04f, -17.61f, -0.5223f, 24.82f, -0.4878f, -22.85f},
+  {141.25f, -17.73f, -0.5274f, 24.59f, -0.5014f, -22.85f},
+  {141.45f, -17.85f, -0.5325f, 24.37f, -0.5146f, -22.85f},
+  {141.65f, -17.97f, -0.5376f, 24.14f, -0.5275f, -22.85f},
+  {141.85f, -18.09f, -0.5426f, 23.91f, -0.5401f, -22.85f},
+  {142.05f, -18.21f, -0.5477f, 23.68f, -0.5524f, -22.85f},
+  {142.26f, -18.33f, -0.5528f, 23.45f, -0.5643f, -22.85f},
+  {142.46f, -18.45f, -0.5579f, 23.22f, -0.5758f, -22.85f},
+  {142.66f, -18.57f, -0.5629f, 22.99f, -0.5871f, -22.85f},
+  {142.86f, -18.69f, -0.5680f, 22.77f, -0.5980f, -22.85f},
+  {143.07f, -18.81f, -0.5731f, 22.54f, -0.6085f, -22.85f},
+  {143.27f, -18.94f, -0.5782f, 22.31f, -0.6187f, -22.85f},
+  {143.47f, -19.06f, -0.5832f, 22.08f, -0.6286f, -22.85f},
+  {143.67f, -19.18f, -0.5883f, 21.85f, -0.6382f, -22.85f},
+  {143.88f, -19.30f, -0.5934f, 21.62f, -0.6474f, -22.85f},
+  {144.08f, -19.42f, -0.5985f, 21.39f, -0.6563f, -22.85f},
+  {144.26f, -19.54f, -0.6053f, 21.24f, -0.6635f, -9.89f},
+  {144.42f, -19.66f, -0.6135f, 21.14f, -0.6695f, -9.89f},
+  {144.57f, -19.79f, -0.6217f, 21.04f, -0.6754f, -9.89f},
+  {144.73f, -19.91f, -0.6299f, 20.94f, -0.6813f, -9.89f},
+  {144.89f, -20.04f, -0.6381f, 20.84f, -0.6870f, -9.89f},
+  {145.05f, -20.16f, -0.6463f, 20.74f, -0.6927f, -9.89f},
+  {145.21f, -20.29f, -0.6545f, 20.64f, -0.6983f, -9.89f},
+  {145.37f, -20.41f, -0.6627f, 20.54f, -0.7038f, -9.89f},
+  {145.53f, -20.54f, -0.6709f, 20.45f, -0.7092f, -9.89f},
+  {145.68f, -20.66f, -0.6792f, 20.35f, -0.7145f, -9.89f},
+  {145.84f, -20.79f, -0.6874f, 20.25f, -0.7197f, -9.89f},
+  {146.00f, -20.91f, -0.6956f, 20.15f, -0.7249f, -9.89f},
+  {146.16f, -21.04f, -0.7038f, 20.05f, -0.7300f, -9.89f},
+  {146.32f, -21.16f, -0.7120f, 19.95f, -0.7349f, -9.89f},
+  {146.48f, -21.29f, -0.7202f, 19.85f, -0.7398f, -9.89f},
+  {146.64f, -21.41f, -0.7284f, 19.75f, -0.7447f, -9.89f},
+  {146.79f, -21.54f, -0.7366f, 19.65f, -0.7494f, -9.89f},
+  {146.95f, -21.66f, -0.7448f, 19.56f, -0.7540f, -9.89f},
+  {147.11f, -21.79f, -0.7530f, 19.46f, -0.7586f, -9.89f},
+  {147.27f, -21.91f, -0.7613f, 19.36f, -0.7631f, -9.89f},
+  {147.43f, -22.04f, -0.7695f, 19.26f, -0.7674f, -9.89f},
+  {147.59f, -22.16f, -0.7777f, 19.16f, -0.7718f, -9.89f},
+  {147.74f, -22.29f, -0.7859f, 19.08f, -0.7751f, 9.97f},
+  {147.87f, -22.45f, -0.7941f, 19.18f, -0.7709f, 9.97f},
+  {147.99f, -22.61f, -0.8023f, 19.28f, -0.7665f, 9.97f},
+  {148.12f, -22.76f, -0.8105f, 19.38f, -0.7621f, 9.97f},
+  {148.24f, -22.92f, -0.8187f, 19.48f, -0.7576f, 9.97f},
+  {148.37f, -23.08f, -0.8269f, 19.58f, -0.7529f, 9.97f},
+  {148.49f, -23.24f, -0.8351f, 19.68f, -0.7482f, 9.97f},
+  {148.62f, -23.40f, -0.8433f, 19.78f, -0.7435f, 9.97f},
+  {148.74f, -23.56f, -0.8516f, 19.88f, -0.7386f, 9.97f},
+  {148.87f, -23.72f, -0.8598f, 19.98f, -0.7336f, 9.97f},
+  {148.99f, -23.87f, -0.8680f, 20.08f, -0.7286f, 9.97f},
+  {149.12f, -24.03f, -0.8762f, 20.18f, -0.7235f, 9.97f},
+  {149.24f, -24.19f, -0.8844f, 20.28f, -0.7183f, 9.97f},
+  {149.37f, -24.35f, -0.8926f, 20.38f, -0.7130f, 9.97f},
+  {149.49f, -24.51f, -0.9008f, 20.48f, -0.7076f, 9.97f},
+  {149.62f, -24.67f, -0.9090f, 20.58f, -0.7021f, 9.97f},
+  {149.74f, -24.83f, -0.9172f, 20.68f, -0.6966f, 9.97f},
+  {149.87f, -24.98f, -0.9254f, 20.78f, -0.6909f, 9.97f},
+  {149.99f, -25.14f, -0.9336f, 20.88f, -0.6852f, 9.97f},
+  {150.12f, -25.30f, -0.9418f, 20.98f, -0.6794f, 9.97f},
+  {150.24f, -25.46f, -0.9500f, 21.07f, -0.6735f, 9.97f},
+  {150.37f, -25.62f, -0.9582f, 21.17f, -0.6675f, 9.97f},
+  {150.49f, -25.78f, -0.9665f, 21.27f, -0.6614f, 9.97f},
+  {150.61f, -25.96f, -0.9726f, 21.46f, -0.6535f, 23.06f},
+  {150.73f, -26.17f, -0.9776f, 21.69f, -0.6445f, 23.06f},
+  {150.86f, -26.37f, -0.9827f, 21.92f, -0.6352f, 23.06f},
+  {150.98f, -26.57f, -0.9878f, 22.15f, -0.6255f, 23.06f},
+  {151.10f, -26.78f, -0.9928f, 22.38f, -0.6154f, 23.06f},
+  {151.22f, -26.98f, -0.9979f, 22.61f, -0.6050f, 23.06f},
+  {151.34f, -27.18f, -1.0029f, 22.84f, -0.5943f, 23.06f},
+  {151.46f, -27.38f, -1.0080f, 23.08f, -0.5832f, 23.06f},
+  {151.58f, -27.59f, -1.0131f, 23.31f, -0.5718f, 23.06f},
+  {151.70f, -27.79f, -1.0181f, 23.54f, -0.5601f, 23.06f},
+  {151.82f, -27.99f, -1.0232f, 23.77f, -0.5480f, 23.06f},
+  {151.94f, -28.19f, -1.0283f, 24.00f, -0.5356f, 23.06f},
+  {152.06f, -28.40f, -1.0333f, 24.23f, -0.5228f, 23.06f},
+  {152.18f, -28.60f, -1.0384f, 24.46f, -0.5097f, 23.06f},
+  {152.30f, -28.80f, -1.0434f, 24.69f, -0.4962f, 23.06f},
+  {152.42f, -29.00f, -1.0485f, 24.92f, -0.4824f, 23.06f},
+  {152.54f, -29.21f, -1.0536f, 25.15f, -0.4683f, 23.06f},
+  {152.67f, -29.41f, -1.0586f, 25.38f, -0.4538f, 23.06f},
+  {152.79f, -29.61f, -1.0637f, 25.61f, -0.4390f, 23.06f},
+  {152.91f, -29.81f, -1.0687f, 25.84f, -0.4238f, 23.06f},
+  {153.03f, -30.06f, -1.0719f, 26.03f, -0.4153f, 18.77f},
+  {153.15f, -30.30f, -1.0751f, 26.22f, -0.4067f, 18.77f},
+  {153.28f, -30.55f, -1.0782f, 26.41f, -0.3980f, 18.77f},
+  {153.40f, -30.79f, -1.0813f, 26.59f, -0.3891f, 18.77f},
+  {153.53f, -31.04f, -1.0844f, 26.78f, -0.3800f, 18.77f},
+  {153.65f, -31.28f, -1.0876f, 26.97f, -0.3708f, 18.77f},
+  {153.77f, -31.53f, -1.0907f, 27.16f, -0.3614f, 18.77f},
+  {153.90f, -31.77f, -1.0938f, 27.35f, -0.3518f, 18.77f},
+  {154.02f, -32.02f, -1.0970f, 27.53f, -0.3421f, 18.77f},
+  {154.14f, -32.26f, -1.1001f, 27.72f, -0.3322f, 18.77f},
+  {154.27f, -32.51f, -1.1032f, 27.91f, -0.3221f, 18.77f},
+  {154.39f, -32.76f, -1.1064f, 28.10f, -0.3119f, 18.77f},
+  {154.52f, -33.00f, -1.1095f, 28.28f, -0.3015f, 18.77f},
+  {154.64f, -33.25f, -1.1126f, 28.47f, -0.2910f, 18.77f},
+  {154.76f, -33.49f, -1.1158f, 28.66f, -0.2802f, 18.77f},
+  {154.89f, -33.74f, -1.1189f, 28.85f, -0.2694f, 18.77f},
+  {155.01f, -33.98f, -1.1220f, 29.04f, -0.2583f, 18.77f},
+  {155.13f, -34.24f, -1.1242f, 29.13f, -0.2504f, 5.62f},
+  {155.26f, -34.51f, -1.1260f, 29.18f, -0.2438f, 5.62f},
+  {155.38f, -34.78f, -1.1279f, 29.24f, -0.2371f, 5.62f},
+  {155.50f, -35.05f, -1.1297f, 29.30f, -0.2303f, 5.62f},
+  {155.62f, -35.32f, -1.1315f, 29.35f, -0.2236f, 5.62f},
+  {155.75f, -35.59f, -1.1334f, 29.41f, -0.2168f, 5.62f},
+  {155.87f, -35.86f, -1.1352f, 29.46f, -0.2100f, 5.62f},
+  {155.99f, -36.12f, -1.1370f, 29.52f, -0.2031f, 5.62f},
+  {156.12f, -36.39f, -1.1388f, 29.58f, -0.1963f, 5.62f},
+  {156.24f, -36.66f, -1.1407f, 29.63f, -0.1894f, 5.62f},
+  {156.36f, -36.93f, -1.1425f, 29.69f, -0.1825f, 5.62f},
+  {156.48f, -37.20f, -1.1443f, 29.75f, -0.1755f, 5.62f},
+  {156.61f, -37.47f, -1.1461f, 29.80f, -0.1685f, 5.62f},
+  {156.73f, -37.74f, -1.1480f, 29.86f, -0.1615f, 5.62f},
+  {156.85f, -38.01f, -1.1498f, 29.91f, -0.1545f, 5.62f},
+  {156.98f, -38.27f, -1.1516f, 29.97f, -0.1474f, 5.62f},
+  {157.10f, -38.55f, -1.1531f, 30.00f, -0.1418f, 0.00f},
+  {157.22f, -38.82f, -1.1541f, 30.00f, -0.1379f, 0.00f},
+  {157.33f, -39.10f, -1.1551f, 30.00f, -0.1339f, 0.00f},
+  {157.45f, -39.37f, -1.1561f, 30.00f, -0.1299f, 0.00f},
+  {157.57f, -39.65f, -1.1572f, 30.00f, -0.1259f, 0.00f},
+  {157.69f, -39.92f, -1.1582f, 30.00f, -0.1219f, 0.00f},
+  {157.81f, -40.20f, -1.1592f, 30.00f, -0.1180f, 0.00f},
+  {157.93f, -40.47f, -1.1602f, 30.00f, -0.1140f, 0.00f},
+  {158.05f, -40.75f, -1.1613f, 30.00f, -0.1100f, 0.00f},
+  {158.17f, -41.02f, -1.1623f, 30.00f, -0.1060f, 0.00f},
+  {158.29f, -41.30f, -1.1633f, 30.00f, -0.1020f, 0.00f},
+  {158.41f, -41.58f, -1.1643f, 30.00f, -0.0981f, 0.00f},
+  {158.52f, -41.85f, -1.1653f, 30.00f, -0.0941f, 0.00f},
+  {158.64f, -42.13f, -1.1664f, 30.00f, -0.0901f, 0.00f},
+  {158.76f, -42.40f, -1.1674f, 30.00f, -0.0861f, 0.00f},
+  {158.88f, -42.68f, -1.1684f, 30.00f, -0.0821f, 0.00f},
+  {159.00f, -42.95f, -1.1693f, 30.00f, -0.0788f, 0.00f},
+  {159.11f, -43.23f, -1.1698f, 30.00f, -0.0766f, 0.00f},
+  {159.23f, -43.51f, -1.1704f, 30.00f, -0.0744f, 0.00f},
+  {159.35f, -43.78f, -1.1710f, 30.00f, -0.0723f, 0.00f},
+  {159.46f, -44.06f, -1.1716f, 30.00f, -0.0701f, 0.00f},
+  {159.58f, -44.34f, -1.1721f, 30.00f, -0.0679f, 0.00f},
+  {159.69f, -44.61f, -1.1727f, 30.00f, -0.0658f, 0.00f},
+  {159.81f, -44.89f, -1.1733f, 30.00f, -0.0636f, 0.00f},
+  {159.92f, -45.17f, -1.1738f, 30.00f, -0.0614f, 0.00f},
+  {160.04f, -45.44f, -1.1744f, 30.00f, -0.0592f, 0.00f},
+  {160.16f, -45.72f, -1.1750f, 30.00f, -0.0571f, 0.00f},
+  {160.27f, -46.00f, -1.1755f, 30.00f, -0.0549f, 0.00f},
+  {160.39f, -46.27f, -1.1761f, 30.00f, -0.0527f, 0.00f},
+  {160.50f, -46.55f, -1.1767f, 30.00f, -0.0506f, 0.00f},
+  {160.62f, -46.83f, -1.1772f, 30.00f, -0.0484f, 0.00f},
+  {160.73f, -47.11f, -1.1778f, 30.00f, -0.0462f, 0.00f},
+  {160.85f, -47.38f, -1.1783f, 30.00f, -0.0442f, 0.00f},
+  {160.96f, -47.66f, -1.1787f, 30.00f, -0.0430f, 0.00f},
+  {161.08f, -47.94f, -1.1790f, 30.00f, -0.0418f, 0.00f},
+  {161.19f, -48.21f, -1.1793f, 30.00f, -0.0406f, 0.00f},
+  {161.30f, -48.49f, -1.1796f, 30.00f, -0.0394f, 0.00f},
+  {161.42f, -48.77f, -1.1799f, 30.00f, -0.0382f, 0.00f},
+  {161.53f, -49.05f, -1.1803f, 30.00f, -0.0369f, 0.00f},
+  {161.65f, -49.33f, -1.1806f, 30.00f, -0.0357f, 0.00f},
+  {161.76f, -49.60f, -1.1809f, 30.00f, -0.0345f, 0.00f},
+  {161.87f, -49.88f, -1.1812f, 30.00f, -0.0333f, 0.00f},
+  {161.99f, -50.16f, -1.1815f, 30.00f, -0.0321f, 0.00f},
+  {162.10f, -50.44f, -1.1818f, 30.00f, -0.0309f, 0.00f},
+  {162.22f, -50.71f, -1.1822f, 30.00f, -0.0297f, 0.00f},
+  {162.33f, -50.99f, -1.1825f, 30.00f, -0.0285f, 0.00f},
+  {162.44f, -51.27f, -1.1828f, 30.00f, -0.0273f, 0.00f},
+  {162.56f, -51.55f, -1.1831f, 30.00f, -0.0261f, 0.00f},
+  {162.67f, -51.82f, -1.1834f, 30.00f, -0.0249f, 0.00f},
+  {162.78f, -52.10f, -1.1836f, 30.00f, -0.0241f, 0.00f},
+  {162.90f, -52.38f, -1.1838f, 30.00f, -0.0235f, 0.00f},
+  {163.01f, -52.66f, -1.1840f, 30.00f, -0.0228f, 0.00f},
+  {163.12f, -52.94f, -1.1842f, 30.00f, -0.0221f, 0.00f},
+  {163.23f, -53.21f, -1.1843f, 30.00f, -0.0214f, 0.00f},
+  {163.35f, -53.49f, -1.1845f, 30.00f, -0.0207f, 0.00f},
+  {163.46f, -53.77f, -1.1847f, 30.00f, -0.0200f, 0.00f},
+  {163.57f, -54.05f, -1.1849f, 30.00f, -0.0194f, 0.00f},
+  {163.69f, -54.33f, -1.1850f, 30.00f, -0.0187f, 0.00f},
+  {163.80f, -54.60f, -1.1852f, 30.00f, -0.0180f, 0.00f},
+  {163.91f, -54.88f, -1.1854f, 30.00f, -0.0173f, 0.00f},
+  {164.02f, -55.16f, -1.1856f, 30.00f, -0.0166f, 0.00f},
+  {164.14f, -55.44f, -1.1858f, 30.00f, -0.0159f, 0.00f},
+  {164.25f, -55.72f, -1.1859f, 30.00f, -0.0153f, 0.00f},
+  {164.36f, -55.99f, -1.1861f, 30.00f, -0.0146f, 0.00f},
+  {164.48f, -56.27f, -1.1863f, 30.00f, -0.0139f, 0.00f},
+  {164.59f, -56.55f, -1.1864f, 30.00f, -0.0134f, 0.00f},
+  {164.70f, -56.83f, -1.1865f, 30.00f, -0.0130f, 0.00f},
+  {164.81f, -57.11f, -1.1866f, 30.00f, -0.0126f, 0.00f},
+  {164.92f, -57.38f, -1.1867f, 30.00f, -0.0122f, 0.00f},
+  {165.04f, -57.66f, -1.1868f, 30.00f, -0.0118f, 0.00f},
+  {165.15f, -57.94f, -1.1869f, 30.00f, -0.0114f, 0.00f},
+  {165.26f, -58.22f, -1.1870f, 30.00f, -0.0110f, 0.00f},
+  {165.37f, -58.50f, -1.1871f, 30.00f, -0.0106f, 0.00f},
+  {165.49f, -58.78f, -1.1872f, 30.00f, -0.0102f, 0.00f},
+  {165.60f, -59.05f, -1.1873f, 30.00f, -0.0098f, 0.00f},
+  {165.71f, -59.33f, -1.1874f, 30.00f, -0.0094f, 0.00f},
+  {165.82f, -59.61f, -1.1875f, 30.00f, -0.0090f, 0.00f},
+  {165.93f, -59.89f, -1.1876f, 30.00f, -0.0086f, 0.00f},
+  {166.05f, -60.17f, -1.1877f, 30.00f, -0.0082f, 0.00f},
+  {166.16f, -60.44f, -1.1878f, 30.00f, -0.0078f, 0.00f},
+  {166.27f, -60.72f, -1.1878f, 30.00f, -0.0074f, 0.00f},
+  {166.38f, -60.99f, -1.1879f, 29.91f, -0.0070f, -32.03f},
+  {166.48f, -61.24f, -1.1880f, 29.59f, -0.0068f, -32.03f},
+  {166.58f, -61.50f, -1.1880f, 29.27f, -0.0065f, -32.03f},
+  {166.68f, -61.75f, -1.1881f, 28.95f, -0.0062f, -32.03f},
+  {166.79f, -62.00f, -1.1881f, 28.63f, -0.0059f, -32.03f},
+  {166.89f, -62.25f, -1.1881f, 28.31f, -0.0056f, -32.03f},
+  {166.99f, -62.50f, -1.1882f, 27.99f, -0.0053f, -32.03f},
+  {167.09f, -62.75f, -1.1882f, 27.67f, -0.0051f, -32.03f},
+  {167.19f, -63.01f, -1.1883f, 27.35f, -0.0048f, -32.03f},
+  {167.29f, -63.26f, -1.1883f, 27.03f, -0.0045f, -32.03f},
+  {167.39f, -63.51f, -1.1884f, 26.70f, -0.0043f, -32.03f},
+  {167.49f, -63.76f, -1.1884f, 26.38f, -0.0040f, -32.03f},
+  {167.59f, -64.01f, -1.1884f, 26.06f, -0.0038f, -32.03f},
+  {167.70f, -64.26f, -1.1885f, 25.74f, -0.0036f, -32.03f},
+  {167.80f, -64.51f, -1.1885f, 25.42f, -0.0033f, -32.03f},
+  {167.90f, -64.77f, -1.1886f, 25.10f, -0.0031f, -32.03f},
+  {168.00f, -65.02f, -1.1886f, 24.78f, -0.0029f, -32.03f},
+  {168.10f, -65.27f, -1.1887f, 24.46f, -0.0026f, -32.03f},
+  {168.19f, -65.49f, -1.1887f, 24.07f, -0.0025f, -59.95f},
+  {168.23f, -65.60f, -1.1887f, 23.47f, -0.0024f, -59.95f},
+  {168.28f, -65.71f, -1.1887f, 22.88f, -0.0023f, -59.95f},
+  {168.32f, -65.82f, -1.1887f, 22.28f, -0.0022f, -59.95f},
+  {168.37f, -65.94f, -1.1887f, 21.68f, -0.0021f, -59.95f},
+  {168.41f, -66.05f, -1.1887f, 21.08f, -0.0020f, -59.95f},
+  {168.46f, -66.16f, -1.1887f, 20.48f, -0.0019f, -59.95f},
+  {168.50f, -66.27f, -1.1887f, 19.88f, -0.0018f, -59.95f},
+  {168.55f, -66.39f, -1.1887f, 19.28f, -0.0018f, -59.95f},
+  {168.59f, -66.50f, -1.1887f, 18.68f, -0.0017f, -59.95f},
+  {168.64f, -66.61f, -1.1887f, 18.08f, -0.0016f, -59.95f},
+  {168.68f, -66.72f, -1.1887f, 17.48f, -0.0015f, -59.95f},
+  {168.73f, -66.84f, -1.1888f, 16.88f, -0.0014f, -59.95f},
+  {168.77f, -66.95f, -1.1888f, 16.28f, -0.0014f, -59.95f},
+  {168.82f, -67.06f, -1.1888f, 15.68f, -0.0013f, -59.95f},
+  {168.86f, -67.17f, -1.1888f, 15.08f, -0.0012f, -59.95f},
+  {168.91f, -67.29f, -1.1888f, 14.48f, -0.0012f, -59.95f},
+  {168.95f, -67.40f, -1.1888f, 13.88f, -0.0011f, -59.95f},
+  {169.00f, -67.51f, -1.1888f, 13.28f, -0.0010f, -59.95f},
+  {169.05f, -67.62f, -1.1888f, 12.68f, -0.0010f, -59.95f},
+  {169.09f, -67.73f, -1.1888f, 12.08f, -0.0009f, -59.95f},
+  {169.14f, -67.85f, -1.1888f, 11.49f, -0.0008f, -59.95f},
+  {169.18f, -67.96f, -1.1888f, 10.89f, -0.0008f, -59.95f},
+  {169.23f, -68.07f, -1.1888f, 10.29f, -0.0007f, -59.95f},
+  {169.27f, -68.18f, -1.1888f, 9.69f, -0.0007f, -59.95f},
+  {169.32f, -68.30f, -1.1888f, 9.09f, -0.0006f, -59.95f},
+  {169.36f, -68.41f, -1.1888f, 8.49f, -0.0006f, -59.95f},
+  {169.41f, -68.52f, -1.1888f, 7.89f, -0.0005f, -59.95f},
+  {169.45f, -68.63f, -1.1888f, 7.29f, -0.0005f, -59.95f},
+  {169.50f, -68.75f, -1.1889f, 6.69f, -0.0004f, -59.95f},
+  {169.54f, -68.86f, -1.1889f, 6.09f, -0.0004f, -59.95f},
+  {169.59f, -68.97f, -1.1889f, 5.49f, -0.0003f, -59.95f},
+  {169.63f, -69.08f, -1.1889f, 4.89f, -0.0003f, -59.95f},
+  {169.68f, -69.20f, -1.1889f, 4.29f, -0.0002f, -59.95f},
+  {169.72f, -69.31f, -1.1889f, 3.69f, -0.0002f, -59.95f},
+  {169.77f, -69.42f, -1.1889f, 3.09f, -0.0002f, -59.95f},
+  {169.81f, -69.53f, -1.1889f, 2.49f, -0.0001f, -59.95f},
+  {169.86f, -69.64f, -1.1889f, 1.89f, -0.0001f, -59.95f},
+  {169.90f, -69.76f, -1.1889f, 1.29f, -0.0001f, -59.95f},
+  {169.95f, -69.87f, -1.1889f, 0.69f, -0.0000f, -59.95f},
+  {169.99f, -69.98f, -1.1889f, 0.10f, -0.0000f, -59.95f},
+  {170.00f, -70.00f, -1.1889f, 0.00f, 0.0000f, 0.00f},
+};
@@ -0,0 +1,315 @@
+// ------- planner.cpp ---------------------------------------------------------
+//
+// Use planner.cpp together with planner.hpp to let the robot find its own way around the
+// field, for example to drive to the next game object after a missed pickup in skills.
+//
+// The field map: fieldObstacles[] holds the field elements as rectangles.  planInit()
+// turns them into a grid with one bit per cell, and "inflates" every obstacle by the
+// robot radius - a cell is blocked when the robot CENTER can not be there.  After that
+// the planner can treat the robot as a single point.  This is done once, planning a
+// route only reads the grid.
+//
+// The search: A* expands the cell with the lowest "cost so far + straight line estimate
+// to the goal" first, so it heads for the goal and only spreads out around obstacles.
+// Those cells are kept in a binary heap, in a fixed array with one slot per cell - no
+// memory is allocated while planning.  Costs are whole numbers, 10 for a straight step
+// and 14 for a diagonal step (10 * square root of 2).
+//
+// The route: A* returns a chain of cells.  We only keep the cells where the route has to
+// change direction - from every waypoint we go to the furthest cell we can still see in
+// a straight line.  A full field route takes a few ms on the brain.
+//
+// This file does not use PROS so host side tools can use it.  The work buffers are
+// static, so only plan one route at a time.
+
+#include <cmath>
+#include <cstdlib>
+#include "planner.hpp"
+
+// ------------------- field elements ----------------------------------------------
+// CHANGE for the game of the season - rectangles in cm, field coordinates.  The field
+// walls are added by planInit() itself.
+
+static const planObstacle fieldObstacles[] = {
+  { 170.9, 120.0, 194.9, 245.8 },     // center barrier
+  {  85.0, 176.9, 120.0, 188.9 },     // left goal post
+  { 245.8, 176.9, 280.8, 188.9 },     // right goal post
+};
+
+static planGrid fieldMap;             // inflated obstacles, built by planInit()
+
+// ------------------- grid helpers --------------------------------------------------
+static inline bool gridGet(const planGrid &grid, int cell) {
+  return (grid.bits[cell >> 5] >> (cell & 31)) & 1;
+}
+
+static inline void gridSet(planGrid &grid, int cell) {
+  grid.bits[cell >> 5] |= 1u << (cell & 31);
+}
+
+static inline int cellOf(int cx, int cy) {
+  return cy * PLAN_GRID + cx;
+}
+
+static inline int toCell(float cm) {
+  int c = (int)(cm / PLAN_CELL);
+  return (c < 0) ? 0 : (c >= PLAN_GRID) ? PLAN_GRID - 1 : c;
+}
+
+static inline float cellCenter(int c) {
+  return (c + 0.5) * PLAN_CELL;
+}
+
+// block every cell whose center is within radius of the rectangle
+static void inflate(planGrid &grid, const planObstacle &o, float radius) {
+  int cx0 = toCell(o.x0 - radius);
+  int cx1 = toCell(o.x1 + radius);
+  int cy0 = toCell(o.y0 - radius);
+  int cy1 = toCell(o.y1 + radius);
+  for(int cy = cy0; cy <= cy1; cy++) {
+    for(int cx = cx0; cx <= cx1; cx++) {
+      float dx = fmaxf(fmaxf(o.x0 - cellCenter(cx), cellCenter(cx) - o.x1), 0);
+      float dy = fmaxf(fmaxf(o.y0 - cellCenter(cy), cellCenter(cy) - o.y1), 0);
+      if(dx * dx + dy * dy <= radius * radius) {
+        gridSet(grid, cellOf(cx, cy));
+      }
+    }
+  }
+}
+
+// ------------------- field map ---------------------------------------------------
+void planInit() {
+  float radius = PLAN_ROBOT_RADIUS + PLAN_MARGIN;
+  for(std::uint32_t &word : fieldMap.bits) {
+    word = 0;
+  }
+  for(const planObstacle &obstacle : fieldObstacles) {
+    inflate(fieldMap, obstacle, radius);
+  }
+  // the walls - the robot center has to stay a robot radius away from them
+  for(int cy = 0; cy < PLAN_GRID; cy++) {
+    for(int cx = 0; cx < PLAN_GRID; cx++) {
+      float x = cellCenter(cx);
+      float y = cellCenter(cy);
+      if(x < PLAN_ROBOT_RADIUS || y < PLAN_ROBOT_RADIUS ||
+         x > FIELD_SIZE - PLAN_ROBOT_RADIUS || y > FIELD_SIZE - PLAN_ROBOT_RADIUS) {
+        gridSet(fieldMap, cellOf(cx, cy));
+      }
+    }
+  }
+}
+
+void planAddObstacle(const planObstacle &obstacle) {
+  inflate(fieldMap, obstacle, PLAN_ROBOT_RADIUS + PLAN_MARGIN);
+}
+
+bool planBlocked(float x, float y) {
+  if(x < 0 || y < 0 || x >= FIELD_SIZE || y >= FIELD_SIZE) {
+    return true;
+  }
+  return gridGet(fieldMap, cellOf(toCell(x), toCell(y)));
+}
+
+// ------------------- A* work buffers -----------------------------------------------
+#define NO_CELL 0xFFFF                // PLAN_CELLS fits in 16 bits
+
+static std::uint32_t costSoFar[PLAN_CELLS];     // g - cost from the start
+static std::uint16_t cameFrom[PLAN_CELLS];      // previous cell on the best route
+static std::uint16_t heapIndex[PLAN_CELLS];     // where the cell is in the heap
+static planGrid closed;                         // cells which are done
+
+struct heapEntry {
+  std::uint32_t score;                // f = cost so far + estimate to the goal
+  std::uint16_t cell;
+};
+static heapEntry heap[PLAN_CELLS];    // every cell is in the heap at most once
+static int heapSize = 0;
+
+static void heapPlace(int i, heapEntry entry) {
+  heap[i] = entry;
+  heapIndex[entry.cell] = i;
+}
+
+static void heapUp(int i) {
+  heapEntry entry = heap[i];
+  while(i > 0 && heap[(i - 1) / 2].score > entry.score) {
+    heapPlace(i, heap[(i - 1) / 2]);
+    i = (i - 1) / 2;
+  }
+  heapPlace(i, entry);
+}
+
+static void heapDown(int i) {
+  heapEntry entry = heap[i];
+  while(true) {
+    int child = 2 * i + 1;
+    if(child >= heapSize) {
+      break;
+    }
+    if(child + 1 < heapSize && heap[child + 1].score < heap[child].score) {
+      child++;
+    }
+    if(heap[child].score >= entry.score) {
+      break;
+    }
+    heapPlace(i, heap[child]);
+    i = child;
+  }
+  heapPlace(i, entry);
+}
+
+// add a cell, or lower its score if it is already waiting in the heap
+static void heapPush(int cell, std::uint32_t score) {
+  if(heapIndex[cell] != NO_CELL) {
+    heap[heapIndex[cell]].score = score;
+    heapUp(heapIndex[cell]);
+    return;
+  }
+  heap[heapSize].score = score;
+  heap[heapSize].cell = cell;
+  heapSize++;
+  heapUp(heapSize - 1);
+}
+
+static int heapPop() {
+  int cell = heap[0].cell;
+  heapIndex[cell] = NO_CELL;
+  heapSize--;
+  if(heapSize > 0) {
+    heap[0] = heap[heapSize];
+    heapDown(0);
+  }
+  return cell;
+}
+
+// octile distance - the exact cost of the route if there were no obstacles
+static std::uint32_t estimate(int cx, int cy, int gx, int gy) {
+  int dx = abs(cx - gx);
+  int dy = abs(cy - gy);
+  return 10 * (dx + dy) - 6 * ((dx < dy) ? dx : dy);
+}
+
+// ------------------- line of sight -------------------------------------------------
+// true if the straight line between the two cell centers only crosses free cells
+static bool lineFree(int a, int b) {
+  float x0 = cellCenter(a % PLAN_GRID);
+  float y0 = cellCenter(a / PLAN_GRID);
+  float x1 = cellCenter(b % PLAN_GRID);
+  float y1 = cellCenter(b / PLAN_GRID);
+  int steps = (int)ceilf(hypotf(x1 - x0, y1 - y0) / (PLAN_CELL / 4));
+  for(int i = 1; i < steps; i++) {
+    float t = (float)i / steps;
+    if(gridGet(fieldMap, cellOf(toCell(x0 + (x1 - x0) * t), toCell(y0 + (y1 - y0) * t)))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ------------------- plan a route --------------------------------------------------
+int planRoute(float startX, float startY, float goalX, float goalY,
+              pathSample* waypoints, int maxWaypoints) {
+  int start = cellOf(toCell(startX), toCell(startY));
+  int goal = cellOf(toCell(goalX), toCell(goalY));
+  int gx = goal % PLAN_GRID;
+  int gy = goal / PLAN_GRID;
+  if(maxWaypoints < 2 || gridGet(fieldMap, goal)) {
+    return 0;                         // nobody can drive there
+  }
+  // the start may be blocked if we were pushed against something, we still plan
+  // from there as the first step leads out of it
+
+  for(int i = 0; i < PLAN_CELLS; i++) {
+    costSoFar[i] = UINT32_MAX;
+    heapIndex[i] = NO_CELL;
+  }
+  for(std::uint32_t &word : closed.bits) {
+    word = 0;
+  }
+  heapSize = 0;
+
+  costSoFar[start] = 0;
+  cameFrom[start] = NO_CELL;
+  heapPush(start, estimate(start % PLAN_GRID, start / PLAN_GRID, gx, gy));
+
+  static const int stepX[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+  static const int stepY[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+  static const int stepCost[8] = {10, 10, 10, 10, 14, 14, 14, 14};
+
+  bool found = false;
+  while(heapSize > 0) {
+    int cell = heapPop();
+    if(cell == goal) {
+      found = true;
+      break;
+    }
+    gridSet(closed, cell);
+    int cx = cell % PLAN_GRID;
+    int cy = cell / PLAN_GRID;
+    for(int i = 0; i < 8; i++) {
+      int nx = cx + stepX[i];
+      int ny = cy + stepY[i];
+      if(nx < 0 || ny < 0 || nx >= PLAN_GRID || ny >= PLAN_GRID) {
+        continue;
+      }
+      int next = cellOf(nx, ny);
+      if(gridGet(closed, next) || gridGet(fieldMap, next)) {
+        continue;
+      }
+      // no cutting diagonally past the corner of a blocked cell
+      if(i >= 4 && (gridGet(fieldMap, cellOf(nx, cy)) || gridGet(fieldMap, cellOf(cx, ny)))) {
+        continue;
+      }
+      std::uint32_t cost = costSoFar[cell] + stepCost[i];
+      if(cost < costSoFar[next]) {
+        costSoFar[next] = cost;
+        cameFrom[next] = cell;
+        heapPush(next, cost + estimate(nx, ny, gx, gy));
+      }
+    }
+  }
+  if(!found) {
+    return 0;
+  }
+
+  // the chain runs from the goal back to the start - turn it around, reusing heapIndex
+  // as the list of cells as the search is done with it
+  int length = 0;
+  for(int cell = goal; cell != NO_CELL; cell = cameFrom[cell]) {
+    heapIndex[length++] = cell;
+  }
+  for(int i = 0; i < length / 2; i++) {
+    std::uint16_t swap = heapIndex[i];
+    heapIndex[i] = heapIndex[length - 1 - i];
+    heapIndex[length - 1 - i] = swap;
+  }
+
+  // keep only the corners: from each waypoint go to the furthest cell still in sight
+  int count = 0;
+  waypoints[count] = {};
+  waypoints[count].x = startX;
+  waypoints[count].y = startY;
+  count++;
+  int from = 0;
+  while(from < length - 1 && count < maxWaypoints - 1) {
+    int to = length - 1;
+    while(to > from + 1 && !lineFree(heapIndex[from], heapIndex[to])) {
+      to--;
+    }
+    if(to < length - 1) {
+      waypoints[count] = {};
+      waypoints[count].x = cellCenter(heapIndex[to] % PLAN_GRID);
+      waypoints[count].y = cellCenter(heapIndex[to] / PLAN_GRID);
+      count++;
+    }
+    from = to;
+  }
+  if(from < length - 1) {
+    return 0;                         // too many corners for the waypoint list
+  }
+  waypoints[count] = {};
+  waypoints[count].x = goalX;
+  waypoints[count].y = goalY;
+  count++;
+  return count;
+}
@@ -0,0 +1,164 @@
+// ------- power.cpp ---------------------------------------------------------
+//
+// Use power.cpp together with power.hpp to share the current between the drive and the
+// intake, instead of giving each motor a fixed limit.
+//
+// The demand: a motor pulls current for the part of its voltage that is not cancelled
+// by its own back emf - the voltage a spinning motor generates.  At full speed the back
+// emf is almost the full 12V, standing still it is 0, so
+//
+//    current = POWER_MOTOR_MAX_MA * (voltage - back emf) / 12V
+//
+// That is large while a side accelerates and small while it cruises.  The drive voltage
+// comes from driveSetVoltage(), the back emf from the measured speed.  The intake runs on
+// the motor's own velocity controller, its demand is what it draws now plus the same
+// estimate for the speed it is still missing.
+//
+// The budget: everyone gets what they need plus POWER_HEADROOM_MA if it fits into
+// POWER_BUDGET_MA, and what is left is shared by weight.  If it does not fit, everyone
+// gets POWER_MIN_MA and the rest is shared by weight - but nobody gets more than they
+// need.  An accelerating drive side and an intake that picks up have POWER_PRIORITY.
+
+#include <cmath>
+#include "main.h"
+#include "globals.hpp"
+#include "feedforward.hpp"            // FF_MAX_VOLTAGE
+#include "drivemodel.hpp"             // DRIVE_FREE_RPM
+#include "intake.hpp"
+#include "power.hpp"
+
+float powerDemand[HEALTH_MOTORS];
+std::int32_t powerLimit[HEALTH_MOTORS];
+
+static pros::Motor* const motors[HEALTH_MOTORS] = {&left_wheel, &right_wheel, &intake_motor};
+
+static float driveCommand[2] = {0, 0};        // mV, last voltage sent to each side
+static std::uint32_t driveCommandTime = 0;    // ms, when it was sent
+
+void powerDriveCommand(float leftVoltage, float rightVoltage) {
+  driveCommand[HEALTH_LEFT] = leftVoltage;
+  driveCommand[HEALTH_RIGHT] = rightVoltage;
+  driveCommandTime = pros::millis();
+}
+
+// ------------------- demand --------------------------------------------------------
+// returns mA, accelerating is set when the drive side needs the current to speed up
+static float driveDemand(int side, bool &accelerating) {
+  pros::Motor &motor = *motors[side];
+  double rpm = motor.get_actual_velocity();
+  std::int32_t drawn = motor.get_current_draw();
+  if(pros::millis() - driveCommandTime > POWER_COMMAND_MS) {
+    accelerating = false;           // not driven by voltage, e.g. braking after a move
+    return (drawn == PROS_ERR) ? POWER_MIN_MA : drawn;
+  }
+  float voltage = driveCommand[side];
+  float backEmf = (rpm == PROS_ERR_F) ? 0 : FF_MAX_VOLTAGE * rpm / DRIVE_FREE_RPM;
+  float push = voltage - backEmf;
+  accelerating = fabsf(push) > POWER_ACCEL_MV && push * voltage > 0;
+  return POWER_MOTOR_MAX_MA * fminf(fabsf(push) / FF_MAX_VOLTAGE, 1);
+}
+
+static float intakeDemand(bool &pickingUp) {
+  intakeState_e state = intakeGetState();
+  pickingUp = state == INTAKE_INTAKING || state == INTAKE_UNJAMMING || state == INTAKE_EJECTING;
+  std::int32_t drawn = intake_motor.get_current_draw();
+  if(drawn == PROS_ERR) {
+    return POWER_MIN_MA;
+  }
+  double missing = fabs(intake_motor.get_target_velocity() - intake_motor.get_actual_velocity());
+  return drawn + POWER_MOTOR_MAX_MA * fminf(missing / POWER_INTAKE_FREE_RPM, 1);
+}
+
+// ------------------- budget --------------------------------------------------------
+// Starts everyone at floor and shares the rest of budget by weight, nobody gets more
+// than their cap.  What a capped motor can not take goes to the others in the next round.
+
+static void share(float budget, const float weight[], const float floor[], const float cap[],
+                  float out[]) {
+  float left = budget;
+  for(int i = 0; i < HEALTH_MOTORS; i++) {
+    out[i] = floor[i];
+    left -= floor[i];
+  }
+  for(int round = 0; round < HEALTH_MOTORS && left > 1; round++) {
+    float totalWeight = 0;
+    for(int i = 0; i < HEALTH_MOTORS; i++) {
+      if(out[i] < cap[i]) {
+        totalWeight += weight[i];
+      }
+    }
+    if(totalWeight <= 0) {
+      break;                          // everyone has all they can take
+    }
+    float given = 0;
+    for(int i = 0; i < HEALTH_MOTORS; i++) {
+      if(out[i] < cap[i]) {
+        float add = fminf(left * weight[i] / totalWeight, cap[i] - out[i]);
+        out[i] += add;
+        given += add;
+      }
+    }
+    left -= given;
+  }
+}
+
+static void allocate(const float weight[]) {
+  float need[HEALTH_MOTORS];
+  float total = 0;
+  for(int i = 0; i < HEALTH_MOTORS; i++) {
+    need[i] = fmaxf(POWER_MIN_MA, fminf(POWER_MOTOR_MAX_MA, powerDemand[i] + POWER_HEADROOM_MA));
+    total += need[i];
+  }
+
+  float limit[HEALTH_MOTORS];
+  if(total <= POWER_BUDGET_MA) {
+    const float full[HEALTH_MOTORS] = {POWER_MOTOR_MAX_MA, POWER_MOTOR_MAX_MA, POWER_MOTOR_MAX_MA};
+    share(POWER_BUDGET_MA, weight, need, full, limit);
+  } else {
+    const float least[HEALTH_MOTORS] = {POWER_MIN_MA, POWER_MIN_MA, POWER_MIN_MA};
+    share(POWER_BUDGET_MA, weight, least, need, limit);
+  }
+
+  for(int i = 0; i < HEALTH_MOTORS; i++) {
+    std::int32_t newLimit = limit[i];
+    if(abs(newLimit - powerLimit[i]) >= POWER_LIMIT_STEP) {
+      motors[i]->set_current_limit(newLimit);
+      powerLimit[i] = newLimit;
+    }
+  }
+}
+
+// ----------------------- power manager task -------------------------------------------
+// Started in initialize() and never killed, it runs above the control loops so the new
+// limits are set before the next loop.
+
+void powerTaskFnc(void* ignore) {
+    //the void* is there to provide a way to pass a
+    //generic value or structure to the task if needed
+    //pros needs this parameter in your function even if you don't use it
+    for(int i = 0; i < HEALTH_MOTORS; i++) {
+      powerDemand[i] = 0;
+      powerLimit[i] = POWER_MOTOR_MAX_MA;
+    }
+    int loops = 0;
+    std::uint32_t now = pros::millis();   // time stamp in milli sec
+    while(true) {
+      bool leftAccel, rightAccel, pickingUp;
+      powerDemand[HEALTH_LEFT] = driveDemand(HEALTH_LEFT, leftAccel);
+      powerDemand[HEALTH_RIGHT] = driveDemand(HEALTH_RIGHT, rightAccel);
+      powerDemand[HEALTH_INTAKE] = intakeDemand(pickingUp);
+
+      float weight[HEALTH_MOTORS];
+      weight[HEALTH_LEFT] = leftAccel ? POWER_PRIORITY : 1;
+      weight[HEALTH_RIGHT] = rightAccel ? POWER_PRIORITY : 1;
+      weight[HEALTH_INTAKE] = pickingUp ? POWER_PRIORITY : 1;
+      allocate(weight);
+
+      if(DEBUG && ++loops % 50 == 0) {
+        std::cout << "Power demand L" << powerDemand[HEALTH_LEFT] << " R" << powerDemand[HEALTH_RIGHT]
+                  << " I" << powerDemand[HEALTH_INTAKE] << " limit L" << powerLimit[HEALTH_LEFT]
+                  << " R" << powerLimit[HEALTH_RIGHT] << " I" << powerLimit[HEALTH_INTAKE] << "\n";
+      }
+      pros::Task::delay_until(&now, POWER_LOOP_MS);
+    }
+}
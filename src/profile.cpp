@@ -0,0 +1,76 @@
+// ------- profile.cpp ---------------------------------------------------------
+//
+// Use profile.cpp together with profile.hpp to plan a smooth movement: instead of asking
+// the motors for the full speed at once we accelerate, cruise and decelerate.  At any time
+// during the move profileSample() tells where we should be, how fast and accelerating
+// how hard - the drivebase controller turns that into motor voltages.
+
+#include <cmath>
+#include "profile.hpp"
+
+// ------------------- create profile ------------------------------------------------
+motionProfile profileCreate(float distance, float maxVel, float maxAccel) {
+  motionProfile profile;
+  profile.distance = distance;
+  profile.maxVel = fabsf(maxVel);
+  profile.maxAccel = fabsf(maxAccel);
+
+  float length = fabsf(distance);
+  if(profile.maxVel <= 0 || profile.maxAccel <= 0 || length <= 0) {
+    profile.accelTime = 0;
+    profile.cruiseTime = 0;
+    profile.cruiseVel = 0;
+    return profile;
+  }
+
+  // distance needed to get to maxVel and back to 0 again
+  float accelDist = (profile.maxVel * profile.maxVel) / profile.maxAccel;
+  if(accelDist >= length) {
+    // triangle - we never reach maxVel
+    profile.cruiseVel = sqrtf(length * profile.maxAccel);
+    profile.cruiseTime = 0;
+  } else {
+    profile.cruiseVel = profile.maxVel;
+    profile.cruiseTime = (length - accelDist) / profile.maxVel;
+  }
+  profile.accelTime = profile.cruiseVel / profile.maxAccel;
+  return profile;
+}
+
+float profileDuration(const motionProfile &profile) {
+  return 2 * profile.accelTime + profile.cruiseTime;
+}
+
+// ------------------- sample profile ------------------------------------------------
+profilePoint profileSample(const motionProfile &profile, float t) {
+  profilePoint point = {0, 0, 0};
+  float sign = (profile.distance < 0) ? -1 : 1;
+  float accelEnd = profile.accelTime;
+  float cruiseEnd = accelEnd + profile.cruiseTime;
+  float end = profileDuration(profile);
+
+  if(t <= 0) {
+    return point;
+  }
+  if(t < accelEnd) {
+    point.position = 0.5 * profile.maxAccel * t * t;
+    point.velocity = profile.maxAccel * t;
+    point.acceleration = profile.maxAccel;
+  } else if(t < cruiseEnd) {
+    float accelDist = 0.5 * profile.maxAccel * accelEnd * accelEnd;
+    point.position = accelDist + profile.cruiseVel * (t - accelEnd);
+    point.velocity = profile.cruiseVel;
+  } else if(t < end) {
+    float left = end - t;           // time until we stop
+    point.position = fabsf(profile.distance) - 0.5 * profile.maxAccel * left * left;
+    point.velocity = profile.maxAccel * left;
+    point.acceleration = -profile.maxAccel;
+  } else {
+    point.position = fabsf(profile.distance);
+  }
+
+  point.position *= sign;
+  point.velocity *= sign;
+  point.acceleration *= sign;
+  return point;
+}
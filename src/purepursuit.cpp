@@ -0,0 +1,241 @@
+// ------- purepursuit.cpp ---------------------------------------------------------
+//
+// Use purepursuit.cpp together with purepursuit.hpp to drive along a path of waypoints
+// without stopping at every corner like driveForDistance() + pivotTurn() do.
+//
+// Pure pursuit works like a driver looking ahead on the road: every loop we look at the
+// point on the path a "lookahead" distance in front of the robot and steer towards it.
+// The lookahead grows with speed, so we cut corners a bit more when driving fast and
+// follow the path more closely when slow.  In sharp parts of the path the speed is
+// lowered, and at the end we slow down so we stop on the last point.
+//
+// All the work done once per path (filling in points, curvature, distance) happens in
+// ppPathCreate() - a loop only looks at the few points around the robot.
+
+#include "main.h"
+#include "globals.hpp"
+#include "drivebase.hpp"
+#include "feedforward.hpp"
+#include "odometry.hpp"
+#include "purepursuit.hpp"
+#include "triggers.hpp"
+#include "motorhealth.hpp"
+
+static float distanceBetween(ppPoint a, ppPoint b) {
+  return sqrtf((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+// ------------------- create path ---------------------------------------------------
+// Fills in points every PP_SPACING cm between the waypoints, then works out the
+// curvature at every point (1 / radius of the circle through it and its neighbours)
+// and how far it is to the end of the path.
+
+void ppPathCreate(ppPath &path, const ppPoint* waypoints, int count) {
+  path.count = 0;
+  for(int i = 0; i < count - 1 && path.count < PP_MAX_POINTS; i++) {
+    ppPoint a = waypoints[i];
+    ppPoint b = waypoints[i + 1];
+    int steps = (int)ceilf(distanceBetween(a, b) / PP_SPACING);
+    for(int s = 0; s < steps && path.count < PP_MAX_POINTS; s++) {
+      float f = (float)s / steps;
+      path.points[path.count++] = {a.x + (b.x - a.x) * f, a.y + (b.y - a.y) * f};
+    }
+  }
+  if(count > 0) {
+    if(path.count >= PP_MAX_POINTS) {
+      path.count = PP_MAX_POINTS - 1;
+      if(DEBUG) { std::cout << "Path too long, cut at " << PP_MAX_POINTS << " points\n"; }
+    }
+    path.points[path.count++] = waypoints[count - 1];
+  }
+
+  for(int i = 0; i < path.count; i++) {
+    path.curvature[i] = 0;
+    if(i > 0 && i < path.count - 1) {
+      // circle through three points: curvature = 4 * triangle area / (a * b * c)
+      ppPoint p = path.points[i - 1];
+      ppPoint q = path.points[i];
+      ppPoint r = path.points[i + 1];
+      float area2 = fabsf((q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x));
+      float sides = distanceBetween(p, q) * distanceBetween(q, r) * distanceBetween(p, r);
+      if(sides > 0) {
+        path.curvature[i] = (2 * area2) / sides;
+      }
+    }
+  }
+
+  float remaining = 0;
+  for(int i = path.count - 1; i >= 0; i--) {
+    if(i < path.count - 1) {
+      remaining += distanceBetween(path.points[i], path.points[i + 1]);
+    }
+    path.remaining[i] = remaining;
+  }
+}
+
+// ------------------- path follower -------------------------------------------------
+void PathFollower::start(const ppPath &newPath, int speed, bool driveReverse) {
+  path = &newPath;
+  reverse = driveReverse;
+  maxVel = driveMaxVelocity(speed) * healthDriveCap();  // RPM to cm/s, see motorhealth.cpp
+  closest = 0;
+  lookIndex = 0;
+  lookFraction = 0;
+  goal = path->points[0];
+  velocity = 0;
+  lastLeftVel = 0;
+  lastRightVel = 0;
+  // safety timeout - the path at half our speed plus 2 sec
+  float length = (path->count > 0) ? path->remaining[0] : 0;
+  timeout = pros::millis() + 2000 + (2000 * length) / fmaxf(maxVel, PP_MIN_SPEED);
+  done = (path->count < 2);
+}
+
+// Look for the point where a circle of radius lookahead around the robot crosses the
+// path.  We only search from the last lookahead point onwards, so the target can never
+// jump back to a part of the path we already drove.
+bool PathFollower::findLookahead(pose_t pose, float lookahead, ppPoint &target) {
+  for(int i = lookIndex; i < path->count - 1; i++) {
+    ppPoint a = path->points[i];
+    ppPoint b = path->points[i + 1];
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    float fx = a.x - pose.x;
+    float fy = a.y - pose.y;
+    float qa = dx * dx + dy * dy;
+    float qb = 2 * (fx * dx + fy * dy);
+    float qc = fx * fx + fy * fy - lookahead * lookahead;
+    float discriminant = qb * qb - 4 * qa * qc;
+    if(qa <= 0 || discriminant < 0) {
+      continue;
+    }
+    discriminant = sqrtf(discriminant);
+    // the far crossing is the one in front of us
+    float t = (-qb + discriminant) / (2 * qa);
+    if(t >= 0 && t <= 1 && (i > lookIndex || t >= lookFraction)) {
+      lookIndex = i;
+      lookFraction = t;
+      target = {a.x + t * dx, a.y + t * dy};
+      return true;
+    }
+    // this segment is completely inside the circle, look further ahead (but only while
+    // it is ahead of the closest point, otherwise we keep the last target)
+    if(i > closest + (int)(PP_MAX_LOOKAHEAD / PP_SPACING) + 1) {
+      break;
+    }
+  }
+  return false;
+}
+
+bool PathFollower::step() {
+  if(done) {
+    return true;
+  }
+  pose_t pose = getPose();
+  if(reverse) {
+    pose.theta += 3.14159;          // drive backwards = drive forwards looking behind
+  }
+
+  // closest point - carried on from the last loop, we only move forward while the
+  // next point is closer, so this costs just a few checks per loop
+  float best = distanceBetween(path->points[closest], {pose.x, pose.y});
+  while(closest < path->count - 1) {
+    float next = distanceBetween(path->points[closest + 1], {pose.x, pose.y});
+    if(next > best) {
+      break;
+    }
+    best = next;
+    closest++;
+  }
+
+  ppPoint last = path->points[path->count - 1];
+  float toEnd = distanceBetween(last, {pose.x, pose.y});
+  if((closest == path->count - 1 && toEnd < PP_END_TOLERANCE) || pros::millis() > timeout) {
+    if(DEBUG && pros::millis() > timeout) { std::cout << "Path timed out!\n"; }
+    stop();
+    return true;
+  }
+
+  // target velocity: slower in corners, accelerate at most DRIVE_MAX_ACCEL and slow
+  // down in time to stop at the end of the path
+  float dt = DRIVE_LOOP_MS / 1000.0;
+  float target = maxVel;
+  if(path->curvature[closest] > 0) {
+    target = fminf(target, PP_TURN_SPEED / path->curvature[closest]);
+  }
+  target = fminf(target, sqrtf(2 * DRIVE_MAX_ACCEL * (path->remaining[closest] + best)));
+  target = fmaxf(target, PP_MIN_SPEED);
+  velocity = fminf(target, velocity + DRIVE_MAX_ACCEL * dt);
+
+  // lookahead point - if the circle does not cross the path we keep the last one, and
+  // once the end of the path is inside the circle we aim for the end point itself
+  float lookahead = fminf(PP_MAX_LOOKAHEAD, PP_MIN_LOOKAHEAD + PP_LOOKAHEAD_GAIN * velocity);
+  if(lookIndex < closest) {
+    lookIndex = closest;
+    lookFraction = 0;
+  }
+  if(toEnd > lookahead) {
+    findLookahead(pose, lookahead, goal);
+  } else {
+    goal = last;
+  }
+
+  // curvature of the arc from the robot through the goal point: 2 * sideways / L^2
+  float dx = goal.x - pose.x;
+  float dy = goal.y - pose.y;
+  float sideways = -sinf(pose.theta) * dx + cosf(pose.theta) * dy;   // + is to the left
+  float distSq = dx * dx + dy * dy;
+  float curvature = (distSq > 0) ? (2 * sideways) / distSq : 0;
+
+  // wheel velocities for that arc, the left side is the inside of a left turn
+  float leftVel = velocity * (2 - curvature * WHEEL_BASE) / 2;
+  float rightVel = velocity * (2 + curvature * WHEEL_BASE) / 2;
+  if(reverse) {
+    float swap = leftVel;           // driving backwards: the sides swap and flip
+    leftVel = -rightVel;
+    rightVel = -swap;
+  }
+
+  float leftMeasured = (left_wheel.get_actual_velocity() * 3.14 * WHEEL_DIAM) / 60;
+  float rightMeasured = (right_wheel.get_actual_velocity() * 3.14 * WHEEL_DIAM) / 60;
+  float leftVoltage = ffVoltage(leftFF, leftVel, (leftVel - lastLeftVel) / dt)
+                      + PP_VEL_KP * (leftVel - leftMeasured);
+  float rightVoltage = ffVoltage(rightFF, rightVel, (rightVel - lastRightVel) / dt)
+                      + PP_VEL_KP * (rightVel - rightMeasured);
+  lastLeftVel = leftVel;
+  lastRightVel = rightVel;
+
+  driveSetVoltage(leftVoltage, rightVoltage);
+  return false;
+}
+
+bool PathFollower::isDone() {
+  return done;
+}
+
+float PathFollower::getTravelled() {
+  if(path == nullptr || path->count == 0) {
+    return 0;
+  }
+  return path->remaining[0] - path->remaining[closest];
+}
+
+void PathFollower::stop() {
+  left_wheel.move_velocity(0);
+  right_wheel.move_velocity(0);
+  done = true;
+}
+
+// ------------------- follow path ---------------------------------------------------
+// Blocks until the end of the path is reached
+void followPath(const ppPath &path, int speed, bool reverse) {
+  PathFollower follower;
+  follower.start(path, speed, reverse);
+  std::uint32_t now = pros::millis();
+  triggersBegin();
+  while(!follower.step()) {
+    triggersCheck(follower.getTravelled());   // position triggers, see triggers.cpp
+    pros::Task::delay_until(&now, DRIVE_LOOP_MS);
+  }
+  triggersEnd();
+}
@@ -0,0 +1,132 @@
+// ------- ramsete.cpp ---------------------------------------------------------
+//
+// Use ramsete.cpp together with ramsete.hpp to drive a precomputed trajectory.
+//
+// Every TRAJ_DT_MS we look up where the trajectory wants us to be (x, y, theta) and how
+// fast (v, omega).  The error between that and our odometry pose is turned around into
+// the robot's point of view - how far too far back, too far to the side, and how much
+// off in heading - and RAMSETE corrects the velocities:
+//
+//    k     = 2 * zeta * sqrt(omega^2 + b * v^2)
+//    v     = v * cos(errorTheta) + k * errorForward
+//    omega = omega + k * errorTheta + b * v * sin(errorTheta) / errorTheta * errorSideways
+//
+// It can steer back onto the trajectory from a sideways error, which a plain PID on
+// each wheel can not.
+
+#include "main.h"
+#include "globals.hpp"
+#include "drivebase.hpp"
+#include "feedforward.hpp"
+#include "odometry.hpp"
+#include "ramsete.hpp"
+#include "triggers.hpp"
+
+// keep an angle between -pi and pi
+static float wrapAngle(float angle) {
+  while(angle > 3.14159) {
+    angle -= 2 * 3.14159;
+  }
+  while(angle < -3.14159) {
+    angle += 2 * 3.14159;
+  }
+  return angle;
+}
+
+// ------------------- trajectory follower -------------------------------------------
+void TrajectoryFollower::start(const trajPoint* newTrajectory, int newCount) {
+  trajectory = newTrajectory;
+  count = newCount;
+  startTime = pros::millis();
+  travelled = 0;
+  done = (count < 1);
+}
+
+bool TrajectoryFollower::step() {
+  if(done) {
+    return true;
+  }
+  float dt = TRAJ_DT_MS / 1000.0;
+
+  // the point for right now - one division, no searching
+  std::uint32_t elapsed = pros::millis() - startTime;
+  int index = elapsed / TRAJ_DT_MS;
+  bool finished = index >= count - 1;
+  const trajPoint &ref = trajectory[finished ? count - 1 : index];
+  float refV = finished ? 0 : ref.v;
+  float refOmega = finished ? 0 : ref.omega;
+  float refA = finished ? 0 : ref.a;
+
+  pose_t pose = getPose();
+  float dx = ref.x - pose.x;
+  float dy = ref.y - pose.y;
+  float errorForward = cosf(pose.theta) * dx + sinf(pose.theta) * dy;
+  float errorSideways = -sinf(pose.theta) * dx + cosf(pose.theta) * dy;
+  float errorTheta = wrapAngle(ref.theta - pose.theta);
+
+  if(finished) {
+    float distance = sqrtf(dx * dx + dy * dy);
+    if(distance < RAMSETE_TOLERANCE ||
+       elapsed > (std::uint32_t)(count - 1) * TRAJ_DT_MS + RAMSETE_SETTLE_MS) {
+      if(DEBUG) { std::cout << "Trajectory done, end error cm: " << distance << "\n"; }
+      stop();
+      return true;
+    }
+  }
+
+  float k = 2 * RAMSETE_ZETA * sqrtf(refOmega * refOmega + RAMSETE_B * refV * refV);
+  k = fmaxf(k, RAMSETE_MIN_K);
+  float sinc = (fabsf(errorTheta) < 0.001) ? 1 : sinf(errorTheta) / errorTheta;
+  float v = refV * cosf(errorTheta) + k * errorForward;
+  float omega = refOmega + k * errorTheta + RAMSETE_B * refV * sinc * errorSideways;
+  travelled += fabsf(refV) * dt;
+
+  // wheel velocities, feedforward plus a little velocity feedback
+  float leftVel = v - omega * WHEEL_BASE / 2;
+  float rightVel = v + omega * WHEEL_BASE / 2;
+  // the trajectory gives the forward acceleration, while turning the sides also speed up
+  // against each other by the change in omega which we take from the next point
+  float leftAcc = 0;
+  float rightAcc = 0;
+  if(!finished) {
+    float omegaDot = (trajectory[index + 1].omega - ref.omega) / dt;
+    leftAcc = refA - omegaDot * WHEEL_BASE / 2;
+    rightAcc = refA + omegaDot * WHEEL_BASE / 2;
+  }
+
+  float leftMeasured = (left_wheel.get_actual_velocity() * 3.14 * WHEEL_DIAM) / 60;
+  float rightMeasured = (right_wheel.get_actual_velocity() * 3.14 * WHEEL_DIAM) / 60;
+  float leftVoltage = ffVoltage(leftFF, leftVel, leftAcc) + RAMSETE_VEL_KP * (leftVel - leftMeasured);
+  float rightVoltage = ffVoltage(rightFF, rightVel, rightAcc) + RAMSETE_VEL_KP * (rightVel - rightMeasured);
+
+  driveSetVoltage(leftVoltage, rightVoltage);
+  return false;
+}
+
+bool TrajectoryFollower::isDone() {
+  return done;
+}
+
+float TrajectoryFollower::getTravelled() {
+  return travelled;
+}
+
+void TrajectoryFollower::stop() {
+  left_wheel.move_velocity(0);
+  right_wheel.move_velocity(0);
+  done = true;
+}
+
+// ------------------- follow trajectory ---------------------------------------------
+// Blocks until the trajectory has been driven
+void followTrajectory(const trajPoint* trajectory, int count) {
+  TrajectoryFollower follower;
+  follower.start(trajectory, count);
+  std::uint32_t now = pros::millis();
+  triggersBegin();
+  while(!follower.step()) {
+    triggersCheck(follower.getTravelled());   // position triggers, see triggers.cpp
+    pros::Task::delay_until(&now, TRAJ_DT_MS);
+  }
+  triggersEnd();
+}
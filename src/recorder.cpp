@@ -0,0 +1,163 @@
+// ------- recorder.cpp ---------------------------------------------------------
+//
+// Use recorder.cpp together with recorder.hpp to make an autonomous route by driving it.
+// Call recordStart() in opcontrol(), drive the route and press RECORD_STOP_BUTTON on the
+// controller.  autoReplay() (autonomous.cpp) then drives it again on its own.
+//
+// While recording nothing but a few numbers per sample go into a fixed buffer, so the
+// recorder keeps its 10ms schedule.  The SD card is only written when the recording
+// ends, in a single write of the whole buffer.
+//
+// We record where the robot went, not which sticks the driver moved: replaying stick
+// inputs would drift away with every bit of wheel slip or a different battery.  The pose
+// of every sample lets the RAMSETE controller correct the robot back onto the route, the
+// wheel velocities tell it how fast to go there.  Only the drivebase is replayed.
+
+#include <cmath>
+#include "main.h"
+#include "globals.hpp"
+#include "odometry.hpp"
+#include "velocity.hpp"
+#include "recorder.hpp"
+#include "tasks.hpp"
+
+bool recording = false;
+
+static recordSample samples[RECORD_MAX_SAMPLES];
+static int sampleCount = 0;
+static char recordName[32];
+static bool stopRequest = false;
+
+// ------------------- file --------------------------------------------------------
+static FILE* openRecording(const char* name, const char* mode) {
+  char path[48];
+  snprintf(path, sizeof(path), "/usd/%s.rec", name);
+  return fopen(path, mode);
+}
+
+static bool saveRecording() {
+  if(!pros::usd::is_installed()) {
+    return false;
+  }
+  FILE* file = openRecording(recordName, "wb");
+  if(file == NULL) {
+    return false;
+  }
+  recordHeader header = {RECORD_MAGIC, RECORD_VERSION, RECORD_LOOP_MS, (std::uint32_t)sampleCount};
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(samples, sizeof(recordSample), sampleCount, file) == (size_t)sampleCount;
+  fclose(file);
+  return ok;
+}
+
+// ------------------- start / stop ------------------------------------------------
+void recordStart(const char* name) {
+  if(recording) {
+    return;
+  }
+  snprintf(recordName, sizeof(recordName), "%s", name);
+  sampleCount = 0;
+  stopRequest = false;
+  recording = true;
+  record = pros::Task (recordTaskFnc, (void*)"PROS", TASK_PRIORITY_DEFAULT + 1,
+                TASK_STACK_DEPTH_DEFAULT, "Record Task");   // above the drive code
+}
+
+void recordStop() {
+  stopRequest = true;
+}
+
+// ------------------- sample ------------------------------------------------------
+static std::int16_t toInt16(float value) {
+  return (std::int16_t)fmaxf(-32767, fminf(32767, roundf(value)));
+}
+
+static recordSample takeSample() {
+  pose_t pose = getPose();
+  float theta = remainderf(pose.theta, 2 * 3.14159);       // between -pi and pi
+  recordSample sample;
+  sample.x = toInt16(pose.x * RECORD_POSITION_SCALE);
+  sample.y = toInt16(pose.y * RECORD_POSITION_SCALE);
+  sample.theta = toInt16(theta * 10000);
+  sample.left = toInt16(leftOdomVelocity.getVelocity() * 10);
+  sample.right = toInt16(rightOdomVelocity.getVelocity() * 10);
+  return sample;
+}
+
+// ----------------------- recorder task -------------------------------------------
+// Samples until the buffer is full, the driver presses RECORD_STOP_BUTTON or
+// recordStop() is called - then saves the recording and ends itself.
+
+void recordTaskFnc(void* ignore) {
+    //the void* is there to provide a way to pass a
+    //generic value or structure to the task if needed
+    //pros needs this parameter in your function even if you don't use it
+    if(DEBUG) { std::cout << "Recording " << recordName << "\n"; }
+    std::uint32_t now = pros::millis();   // time stamp in milli sec
+    while(!stopRequest && sampleCount < RECORD_MAX_SAMPLES &&
+          !master.get_digital(RECORD_STOP_BUTTON)) {
+      samples[sampleCount++] = takeSample();
+      pros::Task::delay_until(&now, RECORD_LOOP_MS);
+    }
+
+    bool saved = saveRecording();
+    if(DEBUG) {
+      std::cout << "Recorded " << sampleCount << " samples, "
+                << (saved ? "saved to SD\n" : "could not save to SD!\n");
+    }
+    master.rumble(saved ? "-" : "...");   // tell the driver the recording ended
+    recording = false;
+    record = (pros::task_t)NULL;
+}
+
+// ------------------- load as trajectory ------------------------------------------
+// The samples become trajectory points: velocity and turn rate from the two wheel
+// velocities, acceleration from the change in velocity.  Headings are stored between
+// -pi and pi, they are unwrapped again so a full turn does not jump back.
+
+int recordLoad(const char* name, trajPoint* trajectory, int maxPoints) {
+  if(recording || !pros::usd::is_installed()) {           // the samples buffer is in use
+    return 0;
+  }
+  FILE* file = openRecording(name, "rb");
+  if(file == NULL) {
+    return 0;
+  }
+  recordHeader header;
+  int count = 0;
+  if(fread(&header, sizeof(header), 1, file) == 1 && header.magic == RECORD_MAGIC &&
+     header.version == RECORD_VERSION && header.dtMs == TRAJ_DT_MS &&
+     (int)header.count <= maxPoints && (int)header.count <= RECORD_MAX_SAMPLES &&
+     fread(samples, sizeof(recordSample), header.count, file) == header.count) {
+    count = header.count;
+  }
+  fclose(file);
+
+  float turned = 0;                     // whole turns added while unwrapping
+  for(int i = 0; i < count; i++) {
+    trajPoint &point = trajectory[i];
+    point.x = samples[i].x / (float)RECORD_POSITION_SCALE;
+    point.y = samples[i].y / (float)RECORD_POSITION_SCALE;
+    point.theta = samples[i].theta / 10000.0 + turned;
+    if(i > 0) {
+      float jump = point.theta - trajectory[i - 1].theta;
+      if(jump > 3.14159) {
+        turned -= 2 * 3.14159;
+        point.theta -= 2 * 3.14159;
+      } else if(jump < -3.14159) {
+        turned += 2 * 3.14159;
+        point.theta += 2 * 3.14159;
+      }
+    }
+    float left = samples[i].left / 10.0;
+    float right = samples[i].right / 10.0;
+    point.v = (left + right) / 2;
+    point.omega = (right - left) / ODOM_TRACK_WIDTH;
+    point.a = 0;
+    if(i > 0) {
+      trajectory[i - 1].a = (point.v - trajectory[i - 1].v) / (TRAJ_DT_MS / 1000.0);
+    }
+  }
+  if(DEBUG) { std::cout << "Recording " << name << " loaded, " << count << " samples\n"; }
+  return count;
+}
@@ -0,0 +1,169 @@
+// ------- spline.cpp ---------------------------------------------------------
+//
+// Use spline.cpp together with spline.hpp to make smooth paths through a list of poses.
+//
+// Between two poses we use a quintic (5th order) Hermite curve, which is the same curve
+// as a quintic Bezier with its control points worked out for us.  It is given by the
+// position, the first derivative (direction times tangent length) and the second
+// derivative at both ends.  We set the second derivative to 0 at every pose, so the
+// curvature is 0 there and also matches between two segments - the path is C2
+// continuous and the robot never has to jump its turn rate.
+//
+// The curve is a function of t (0 to 1) and not of distance, and for a trajectory we need
+// the point at a given distance.  So once, when the path is created, we build a table of
+// the distance at evenly spaced t values.  Looking up a distance is then a binary search
+// in that table, and one Newton step to land exactly on it.  Heading and curvature come
+// straight from the derivatives of the polynomials - no differencing of close points.
+//
+// This file does not use PROS so host side tools can use it.
+
+#include <cmath>
+#include "spline.hpp"
+
+// ------------------- polynomial helpers --------------------------------------------
+static float poly(const float* a, float t) {
+  return a[0] + t * (a[1] + t * (a[2] + t * (a[3] + t * (a[4] + t * a[5]))));
+}
+
+static float polyD1(const float* a, float t) {
+  return a[1] + t * (2 * a[2] + t * (3 * a[3] + t * (4 * a[4] + t * 5 * a[5])));
+}
+
+static float polyD2(const float* a, float t) {
+  return 2 * a[2] + t * (6 * a[3] + t * (12 * a[4] + t * 20 * a[5]));
+}
+
+static float speedAt(const splineSegment &segment, float t) {
+  float dx = polyD1(segment.ax, t);
+  float dy = polyD1(segment.ay, t);
+  return sqrtf(dx * dx + dy * dy);
+}
+
+// quintic Hermite coefficients for one axis, with second derivative 0 at both ends
+static void hermite(float* a, float p0, float v0, float p1, float v1) {
+  a[0] = p0;
+  a[1] = v0;
+  a[2] = 0;
+  a[3] = -10 * p0 - 6 * v0 - 4 * v1 + 10 * p1;
+  a[4] = 15 * p0 + 8 * v0 + 7 * v1 - 15 * p1;
+  a[5] = -6 * p0 - 3 * v0 - 3 * v1 + 6 * p1;
+}
+
+// ------------------- create ----------------------------------------------------------
+bool splineCreate(splinePath &path, const splinePose* poses, int count) {
+  path.segmentCount = 0;
+  if(count < 2 || count > SPLINE_MAX_SEGMENTS + 1) {
+    return false;
+  }
+
+  for(int i = 0; i < count - 1; i++) {
+    const splinePose &a = poses[i];
+    const splinePose &b = poses[i + 1];
+    float distance = sqrtf((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
+    float tangent = distance * SPLINE_TANGENT_SCALE;
+    splineSegment &segment = path.segments[i];
+    hermite(segment.ax, a.x, tangent * cosf(a.theta), b.x, tangent * cosf(b.theta));
+    hermite(segment.ay, a.y, tangent * sinf(a.theta), b.y, tangent * sinf(b.theta));
+  }
+  path.segmentCount = count - 1;
+
+  // arc length table - Simpson's rule over every table step
+  float h = 1.0 / SPLINE_TABLE_STEPS;
+  path.length[0] = 0;
+  int k = 0;
+  for(int i = 0; i < path.segmentCount; i++) {
+    for(int step = 0; step < SPLINE_TABLE_STEPS; step++) {
+      float t = step * h;
+      const splineSegment &segment = path.segments[i];
+      float part = h / 6 * (speedAt(segment, t) + 4 * speedAt(segment, t + h / 2) + speedAt(segment, t + h));
+      path.length[k + 1] = path.length[k] + part;
+      k++;
+    }
+  }
+  return true;
+}
+
+float splineLength(const splinePath &path) {
+  return path.length[path.segmentCount * SPLINE_TABLE_STEPS];
+}
+
+// ------------------- point at distance -----------------------------------------------
+pathSample splineAt(const splinePath &path, float distance) {
+  pathSample sample = {};
+  if(path.segmentCount < 1) {
+    return sample;
+  }
+  int last = path.segmentCount * SPLINE_TABLE_STEPS;
+  if(distance < 0) {
+    distance = 0;
+  }
+  if(distance > path.length[last]) {
+    distance = path.length[last];
+  }
+
+  // binary search for the table step which holds this distance
+  int low = 0;
+  int high = last;
+  while(high - low > 1) {
+    int middle = (low + high) / 2;
+    if(path.length[middle] <= distance) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+
+  int segmentIndex = low / SPLINE_TABLE_STEPS;
+  if(segmentIndex >= path.segmentCount) {
+    segmentIndex = path.segmentCount - 1;         // only for the very end of the path
+  }
+  const splineSegment &segment = path.segments[segmentIndex];
+  float h = 1.0 / SPLINE_TABLE_STEPS;
+  float t0 = (low - segmentIndex * SPLINE_TABLE_STEPS) * h;
+
+  // interpolate inside the step, then one Newton step: t += missing distance / speed
+  float stepLength = path.length[low + 1] - path.length[low];
+  float t = t0 + ((stepLength > 0) ? (distance - path.length[low]) / stepLength * h : 0);
+  float speed = speedAt(segment, t);
+  if(speed > 0) {
+    float travelled = path.length[low] + (t - t0) / 6 *
+                      (speedAt(segment, t0) + 4 * speedAt(segment, (t0 + t) / 2) + speed);
+    t += (distance - travelled) / speed;
+  }
+  if(t < 0) {
+    t = 0;
+  }
+  if(t > 1) {
+    t = 1;
+  }
+
+  float dx = polyD1(segment.ax, t);
+  float dy = polyD1(segment.ay, t);
+  float ddx = polyD2(segment.ax, t);
+  float ddy = polyD2(segment.ay, t);
+  float speedSquared = dx * dx + dy * dy;
+
+  sample.x = poly(segment.ax, t);
+  sample.y = poly(segment.ay, t);
+  sample.theta = atan2f(dy, dx);
+  sample.curvature = (speedSquared > 0) ? (dx * ddy - dy * ddx) / (speedSquared * sqrtf(speedSquared)) : 0;
+  sample.s = distance;
+  return sample;
+}
+
+// ------------------- sample the whole path -------------------------------------------
+int splineSample(const splinePath &path, pathSample* samples, int maxSamples, float spacing) {
+  if(path.segmentCount < 1 || maxSamples < 2 || spacing <= 0) {
+    return 0;
+  }
+  float length = splineLength(path);
+  int count = (int)ceilf(length / spacing) + 1;
+  if(count > maxSamples) {
+    count = maxSamples;                           // path is cut short
+  }
+  for(int i = 0; i < count - 1; i++) {
+    samples[i] = splineAt(path, i * spacing);
+  }
+  samples[count - 1] = splineAt(path, fminf((count - 1) * spacing, length));
+  return count;
+}
@@ -3,16 +3,22 @@
 #include "globals.hpp"
 #include "pros/apix.h"								// we need the advanced API header
 #include "pros/rtos.h"
+#include "velocity.hpp"
+#include "odometry.hpp"
 
 pros::task_t intake = (pros::task_t)NULL;
 pros::task_t drive = (pros::task_t)NULL;
 pros::task_t odom = (pros::task_t)NULL;
 pros::task_t display = (pros::task_t)NULL;
+pros::task_t velocity = (pros::task_t)NULL;
+pros::task_t optical = (pros::task_t)NULL;
+pros::task_t record = (pros::task_t)NULL;
+pros::task_t monitor = (pros::task_t)NULL;
+pros::task_t battery = (pros::task_t)NULL;
+pros::task_t power = (pros::task_t)NULL;
 
 // task inter communication variables (globals)
 bool odomResetFlag = false;       // reset reporting odometres to 0
-bool runIntakeNow = false;        // stop / start the intake mechanism
-bool reverseIntake = false;       // reverse direction of intake mechanism
 
 /*----------------------------------------------------------------------------*/
 // task we keep running all the time to show the number of active rtos tasks
@@ -33,8 +39,8 @@ void displayTaskFnc(void* ignore) {
 }
 
 /*----------------------------------------------------------------------------*/
-// task we keep running all the time to report the odom difference between
-// the left and right wheel
+// task we keep running all the time to track the robot pose (see odometry.cpp) and
+// report the odom difference between the left and right wheel
 //
 void odomTaskFnc(void* ignore) {
     //the void* is there to provide a way to pass a
@@ -47,19 +53,29 @@ void odomTaskFnc(void* ignore) {
     if(right_odom.get_reversed() > 0){
       right_odom.set_reversed(true);
     }
+    odomReset();
 
+    int loops = 0;
     std::uint32_t now = pros::millis();   // time stamp in milli sec
     while(true){
        if(odomResetFlag){
          // requested odometer odometer resets to 0
          left_odom.reset_position();
          right_odom.reset_position();
+         leftOdomVelocity.reset();      // estimators restart from the new 0
+         rightOdomVelocity.reset();
+         odomReset();                   // pose starts at 0,0 again
+         odomResetFlag = false;         // only reset once per request
        }
 
-       // get the left and right odom and show the difference
-       int odom_diff = left_odom.get_position() - right_odom.get_position();
-       std::cout << "Odom drift: " << odom_diff << "\n";
-       pros::Task::delay_until(&now, 50);     // ensure consitent 50ms (20Hz cycle)
+       odomUpdate();
+
+       // get the left and right odom and show the difference - every 50ms is enough
+       if(++loops % 5 == 0) {
+         int odom_diff = left_odom.get_position() - right_odom.get_position();
+         std::cout << "Odom drift: " << odom_diff << "\n";
+       }
+       pros::Task::delay_until(&now, ODOM_LOOP_MS);     // ensure consitent 10ms (100Hz cycle)
     }
 }
 
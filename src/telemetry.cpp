@@ -0,0 +1,82 @@
+// ------- telemetry.cpp ---------------------------------------------------------
+//
+// Use telemetry.cpp together with telemetry.hpp to record what the robot is doing, for
+// example voltages and velocities during a test run.  The samples are kept in memory and
+// written as a CSV file to the SD card afterwards, from there we can open them in a
+// spreadsheet or a host side tool.
+
+#include "main.h"
+#include "globals.hpp"
+#include "telemetry.hpp"
+
+struct telemetrySample {
+  std::uint32_t time;                     // ms since program start
+  float values[TELEMETRY_CHANNELS];
+};
+
+static telemetrySample samples[TELEMETRY_MAX_SAMPLES];
+static int sampleCount = 0;
+static int channelCount = 0;
+static char logName[32] = "telemetry";
+static char logColumns[128] = "";
+
+// ------------------- start a new recording -----------------------------------------
+void telemetryStart(const char* name, const char* columns) {
+  snprintf(logName, sizeof(logName), "%s", name);
+  snprintf(logColumns, sizeof(logColumns), "%s", columns);
+  sampleCount = 0;
+  channelCount = 0;
+}
+
+// ------------------- record one sample ---------------------------------------------
+void telemetryRecord(const float* values, int count) {
+  if(sampleCount >= TELEMETRY_MAX_SAMPLES) {
+    return;                               // buffer full, we keep the first samples
+  }
+  if(count > TELEMETRY_CHANNELS) {
+    count = TELEMETRY_CHANNELS;
+  }
+  telemetrySample &sample = samples[sampleCount++];
+  sample.time = pros::millis();
+  for(int i = 0; i < count; i++) {
+    sample.values[i] = values[i];
+  }
+  if(count > channelCount) {
+    channelCount = count;
+  }
+}
+
+int telemetryCount() {
+  return sampleCount;
+}
+
+// ------------------- save recording ------------------------------------------------
+// Writes all samples as CSV, first column is the time in ms.  Without an SD card the
+// lines go to the terminal (menu PROS -> Open Terminal) so they can be copied from there.
+bool telemetrySave() {
+  FILE* file = stdout;
+  if(pros::usd::is_installed()) {
+    char path[48];
+    snprintf(path, sizeof(path), "/usd/%s.csv", logName);
+    file = fopen(path, "w");
+    if(file == NULL) {
+      if(DEBUG) { std::cout << "Could not open " << path << "\n"; }
+      return false;
+    }
+  }
+
+  fprintf(file, "time,%s\n", logColumns);
+  for(int i = 0; i < sampleCount; i++) {
+    fprintf(file, "%u", (unsigned int)samples[i].time);
+    for(int c = 0; c < channelCount; c++) {
+      fprintf(file, ",%.3f", samples[i].values[c]);
+    }
+    fprintf(file, "\n");
+  }
+
+  if(file != stdout) {
+    fclose(file);
+  }
+  if(DEBUG) { std::cout << "Telemetry " << logName << " saved, samples: " << sampleCount << "\n"; }
+  return true;
+}
@@ -0,0 +1,140 @@
+// ------- traction.cpp ---------------------------------------------------------
+//
+// Use traction.cpp together with traction.hpp to detect wheel slip on the drivebase
+// and to limit how fast the drivebase may accelerate while it slips.
+//
+// The drive motors (left_wheel, right_wheel) measure how far the powered wheels turned,
+// the odometers (left_odom, right_odom) measure how far the robot really moved as they
+// are not powered and can not spin on the field tiles.  If a motor wheel turns faster
+// than its odometer wheel the powered wheel is slipping - we flag those samples and keep
+// track of the distance the motor encoder "thinks" we travelled but we did not.
+
+#include "main.h"
+#include "globals.hpp"
+#include "drivebase.hpp"
+#include "traction.hpp"
+#include "velocity.hpp"
+
+bool leftSlipping = false;          // slip flags - see traction.hpp
+bool rightSlipping = false;
+float leftSlipLoss = 0;             // cm of motor travel lost to slip
+float rightSlipLoss = 0;
+int slipSampleCount = 0;            // number of slip samples since tractionReset()
+
+// last positions seen, used to calculate the movement between two samples
+static double lastLeftMotor = 0;
+static double lastRightMotor = 0;
+static double lastLeftOdom = 0;
+static double lastRightOdom = 0;
+
+// number of consecutive samples each side looked like it was slipping
+static int leftSlipCount = 0;
+static int rightSlipCount = 0;
+
+// ------------------- unit conversions --------------------------------------------
+// motors report in degrees (E_MOTOR_ENCODER_DEGREES), the rotation sensors report
+// in centidegrees - convert both to cm travelled on the field
+
+static double motorDegToCm(double degrees) {
+  return (degrees / 360) * (3.14 * WHEEL_DIAM);
+}
+
+static double odomCentiDegToCm(double centiDegrees) {
+  return (centiDegrees / 36000) * (3.14 * ODOM_WHEEL_DIAM);
+}
+
+// ------------------- traction reset ----------------------------------------------
+// Call at the start of every movement, it takes a new baseline of all encoders
+// and clears the slip flags and lost distance.
+
+void tractionReset() {
+  lastLeftMotor = left_wheel.get_position();
+  lastRightMotor = right_wheel.get_position();
+  lastLeftOdom = left_odom.get_position();
+  lastRightOdom = right_odom.get_position();
+
+  leftSlipping = false;
+  rightSlipping = false;
+  leftSlipCount = 0;
+  rightSlipCount = 0;
+  leftSlipLoss = 0;
+  rightSlipLoss = 0;
+  slipSampleCount = 0;
+}
+
+// ------------------- slip check for one side -------------------------------------
+// Compares the motor wheel speed with the filtered odometer wheel speed (velocity.cpp).
+// The side is only flagged once it slipped for SLIP_SAMPLES samples in a row, this
+// keeps sensor noise from being seen as slip.  Once flagged the extra travel of the
+// motor wheel is added to the lost distance.
+
+static bool checkSide(double motorCm, double odomCm, double motorSpeed, double odomSpeed,
+                      int &count, float &loss) {
+  motorSpeed = fabs(motorSpeed);                  // cm/s
+  odomSpeed = fabs(odomSpeed);                    // cm/s
+
+  bool slip = false;
+  if(motorSpeed > SLIP_MIN_SPEED && (motorSpeed - odomSpeed) > (motorSpeed * SLIP_RATIO)) {
+    count++;
+    slip = (count >= SLIP_SAMPLES);
+  } else {
+    count = 0;
+  }
+
+  if(slip) {
+    loss += (motorCm - odomCm);                   // keeps the sign of direction
+  }
+  return slip;
+}
+
+// ------------------- traction update ---------------------------------------------
+// Call this every control tick (10ms) while the drivebase is moving.  Returns true
+// when either side of the drivebase is slipping.
+
+bool tractionUpdate() {
+  double leftMotor = left_wheel.get_position();
+  double rightMotor = right_wheel.get_position();
+  double leftOdom = left_odom.get_position();
+  double rightOdom = right_odom.get_position();
+
+  double leftMotorCm = motorDegToCm(leftMotor - lastLeftMotor);
+  double rightMotorCm = motorDegToCm(rightMotor - lastRightMotor);
+  double leftOdomCm = odomCentiDegToCm(leftOdom - lastLeftOdom);
+  double rightOdomCm = odomCentiDegToCm(rightOdom - lastRightOdom);
+
+  lastLeftMotor = leftMotor;
+  lastRightMotor = rightMotor;
+  lastLeftOdom = leftOdom;
+  lastRightOdom = rightOdom;
+
+  // motor velocity comes in RPM, turn it into cm/s like the odometer estimators
+  double leftMotorSpeed = motorDegToCm(left_wheel.get_actual_velocity() * 6);
+  double rightMotorSpeed = motorDegToCm(right_wheel.get_actual_velocity() * 6);
+
+  leftSlipping = checkSide(leftMotorCm, leftOdomCm, leftMotorSpeed, leftOdomVelocity.getVelocity(),
+                           leftSlipCount, leftSlipLoss);
+  rightSlipping = checkSide(rightMotorCm, rightOdomCm, rightMotorSpeed, rightOdomVelocity.getVelocity(),
+                            rightSlipCount, rightSlipLoss);
+
+  if(leftSlipping || rightSlipping) {
+    slipSampleCount++;
+    if(DEBUG) {
+      std::cout << "Slip left: " << leftSlipping << " right: " << rightSlipping
+                << " lost cm left: " << leftSlipLoss << " right: " << rightSlipLoss << "\n";
+    }
+  }
+  return leftSlipping || rightSlipping;
+}
+
+// ------------------- acceleration limiter ----------------------------------------
+// The drivebase follows a motion profile (profile.cpp) which already limits the
+// acceleration.  When the wheels slip anyway we let the profile time run slower,
+// this lowers both the wanted speed increase and the acceleration until the
+// wheels grip again.
+
+float tractionTimeScale() {
+  if(leftSlipping || rightSlipping) {
+    return TRACTION_SLIP_TIMESCALE;
+  }
+  return 1.0;
+}
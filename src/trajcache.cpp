@@ -0,0 +1,122 @@
+// ------- trajcache.cpp ---------------------------------------------------------
+//
+// Use trajcache.cpp together with trajcache.hpp to keep trajectories generated on the
+// brain on the SD card.  Generating a trajectory (trajectory.cpp) smooths the path and
+// runs over it several times, which takes long enough to notice when the robot is turned
+// on.  Reading it back from the card is a single sequential read of the whole file
+// straight into the trajectory buffer - no parsing and no allocations.
+//
+// Trajectories which never change are better made on the computer with "make paths"
+// (tools/pathgen.cpp), the cache is for paths that are built while the program runs.
+
+#include "main.h"
+#include "globals.hpp"
+#include "trajcache.hpp"
+
+// path samples are only needed while generating, one shared buffer is enough
+static pathSample cacheSamples[TRAJ_CACHE_MAX_SAMPLES];
+
+// ------------------- hash --------------------------------------------------------
+// FNV-1a over the raw bytes of the waypoints and constraints, plus the cache version.
+// The same inputs always give the same 32 bit number.
+
+static std::uint32_t fnv1a(std::uint32_t hash, const void* data, int size) {
+  const std::uint8_t* bytes = (const std::uint8_t*)data;
+  for(int i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;                    // FNV prime
+  }
+  return hash;
+}
+
+std::uint32_t trajCacheHash(const pathSample* waypoints, int count,
+                            const trajConstraints &constraints) {
+  std::uint32_t hash = 2166136261u;       // FNV offset basis
+  std::uint32_t version = TRAJ_CACHE_VERSION;
+  hash = fnv1a(hash, &version, sizeof(version));
+  for(int i = 0; i < count; i++) {
+    // only the position of a waypoint is used to make the path
+    hash = fnv1a(hash, &waypoints[i].x, sizeof(float));
+    hash = fnv1a(hash, &waypoints[i].y, sizeof(float));
+  }
+  hash = fnv1a(hash, &constraints, sizeof(constraints));
+  return hash;
+}
+
+// ------------------- file name ---------------------------------------------------
+// The hash is the file name, for example /usd/paths/5f3a09c1.trj
+// PROS can not create folders, so if TRAJ_CACHE_DIR was not made on the card we fall
+// back to the root of the card.
+
+static FILE* openCacheFile(std::uint32_t hash, const char* mode) {
+  char path[48];
+  snprintf(path, sizeof(path), TRAJ_CACHE_DIR "/%08lx.trj", (unsigned long)hash);
+  FILE* file = fopen(path, mode);
+  if(file == NULL) {
+    snprintf(path, sizeof(path), "/usd/traj_%08lx.trj", (unsigned long)hash);
+    file = fopen(path, mode);
+  }
+  return file;
+}
+
+// ------------------- load --------------------------------------------------------
+static int loadTrajectory(std::uint32_t hash, trajPoint* trajectory, int maxPoints) {
+  FILE* file = openCacheFile(hash, "rb");
+  if(file == NULL) {
+    return 0;
+  }
+  trajCacheHeader header;
+  int count = 0;
+  if(fread(&header, sizeof(header), 1, file) == 1 && header.magic == TRAJ_CACHE_MAGIC &&
+     header.version == TRAJ_CACHE_VERSION && header.hash == hash &&
+     (int)header.count <= maxPoints) {
+    // the points are stored as they are in memory, read them all in one go
+    if(fread(trajectory, sizeof(trajPoint), header.count, file) == header.count) {
+      count = header.count;
+    }
+  }
+  fclose(file);
+  return count;
+}
+
+// ------------------- save --------------------------------------------------------
+static bool saveTrajectory(std::uint32_t hash, const trajPoint* trajectory, int count) {
+  FILE* file = openCacheFile(hash, "wb");
+  if(file == NULL) {
+    return false;
+  }
+  trajCacheHeader header = {TRAJ_CACHE_MAGIC, TRAJ_CACHE_VERSION, hash, (std::uint32_t)count};
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(trajectory, sizeof(trajPoint), count, file) == (size_t)count;
+  fclose(file);
+  return ok;
+}
+
+// ------------------- load or generate --------------------------------------------
+int trajCacheGet(const pathSample* waypoints, int count, const trajConstraints &constraints,
+                 trajPoint* trajectory, int maxPoints) {
+  std::uint32_t hash = trajCacheHash(waypoints, count, constraints);
+  bool haveCard = pros::usd::is_installed();
+
+  if(haveCard) {
+    int loaded = loadTrajectory(hash, trajectory, maxPoints);
+    if(loaded > 0) {
+      if(DEBUG) { std::cout << "Trajectory " << hash << " loaded from SD, points: " << loaded << "\n"; }
+      return loaded;
+    }
+  }
+
+  // not on the card (yet) - generate it
+  std::uint32_t start = pros::millis();
+  int samples = pathFromWaypoints(waypoints, count, cacheSamples, TRAJ_CACHE_MAX_SAMPLES);
+  int points = trajGenerate(cacheSamples, samples, constraints, trajectory, maxPoints);
+  if(DEBUG) {
+    std::cout << "Trajectory " << hash << " generated, points: " << points
+              << " in " << pros::millis() - start << "ms\n";
+  }
+
+  if(haveCard && points > 0 && !saveTrajectory(hash, trajectory, points)) {
+    if(DEBUG) { std::cout << "Could not save trajectory " << hash << " to SD\n"; }
+  }
+  return points;
+}
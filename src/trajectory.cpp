@@ -0,0 +1,183 @@
+// ------- trajectory.cpp ---------------------------------------------------------
+//
+// Use trajectory.cpp together with trajectory.hpp to turn a path (where to drive) into a
+// trajectory (where to be at what time, and how fast).
+//
+// The fastest way along a path is found in three steps:
+//  1. every sample gets a speed limit: the maximum velocity, and in curves the outside
+//     wheel may not go faster than maxWheelVel
+//  2. forward pass - from the start, we can only go as fast as accelerating at maxAccel
+//     from the sample before allows: v^2 = v_before^2 + 2 * a * distance
+//  3. backward pass - the same from the end, so we can always brake in time to stop
+// Then we walk along the path in time steps of TRAJ_DT_MS and write out the points.
+//
+// Each step is a single loop over the samples, so even a full skills path is computed
+// on the brain in a few ms.  This file does not use PROS so host side tools can use it.
+
+#include <cmath>
+#include "trajectory.hpp"
+
+// ------------------- path geometry -------------------------------------------------
+// Works out s (distance along the path), theta and curvature from x and y only
+void pathComputeGeometry(pathSample* samples, int count) {
+  if(count < 1) {
+    return;
+  }
+  samples[0].s = 0;
+  for(int i = 1; i < count; i++) {
+    float dx = samples[i].x - samples[i - 1].x;
+    float dy = samples[i].y - samples[i - 1].y;
+    samples[i].s = samples[i - 1].s + sqrtf(dx * dx + dy * dy);
+  }
+  for(int i = 0; i < count; i++) {
+    int a = (i > 0) ? i - 1 : i;
+    int b = (i < count - 1) ? i + 1 : i;
+    samples[i].theta = atan2f(samples[b].y - samples[a].y, samples[b].x - samples[a].x);
+  }
+  for(int i = 0; i < count; i++) {
+    int a = (i > 0) ? i - 1 : i;
+    int b = (i < count - 1) ? i + 1 : i;
+    float turn = samples[b].theta - samples[a].theta;
+    while(turn > 3.14159) {
+      turn -= 2 * 3.14159;
+    }
+    while(turn < -3.14159) {
+      turn += 2 * 3.14159;
+    }
+    float length = samples[b].s - samples[a].s;
+    samples[i].curvature = (length > 0) ? turn / length : 0;
+  }
+}
+
+// ------------------- path from waypoints -------------------------------------------
+// Fill in samples every PATH_SPACING cm and smooth them: every sample is pulled a bit
+// towards where it was and a bit towards the middle of its neighbours, until nothing
+// moves anymore.  The first and last sample stay where they are.
+
+int pathFromWaypoints(const pathSample* waypoints, int count, pathSample* samples, int maxSamples) {
+  int n = 0;
+  for(int i = 0; i < count - 1 && n < maxSamples - 1; i++) {
+    float dx = waypoints[i + 1].x - waypoints[i].x;
+    float dy = waypoints[i + 1].y - waypoints[i].y;
+    int steps = (int)ceilf(sqrtf(dx * dx + dy * dy) / PATH_SPACING);
+    for(int step = 0; step < steps && n < maxSamples - 1; step++) {
+      samples[n].x = waypoints[i].x + dx * step / steps;
+      samples[n].y = waypoints[i].y + dy * step / steps;
+      n++;
+    }
+  }
+  if(count < 1 || maxSamples < 1) {
+    return 0;
+  }
+  samples[n].x = waypoints[count - 1].x;
+  samples[n].y = waypoints[count - 1].y;
+  n++;
+
+  // while smoothing, theta and curvature hold the unsmoothed position of each sample -
+  // pathComputeGeometry() fills in their real values afterwards.  This way we do not
+  // need a second buffer on the brain.
+  for(int i = 0; i < n; i++) {
+    samples[i].theta = samples[i].x;
+    samples[i].curvature = samples[i].y;
+  }
+  float change = PATH_SMOOTH_TOLERANCE;
+  while(change >= PATH_SMOOTH_TOLERANCE) {
+    change = 0;
+    for(int i = 1; i < n - 1; i++) {
+      float oldX = samples[i].x;
+      float oldY = samples[i].y;
+      samples[i].x += PATH_SMOOTH_DATA * (samples[i].theta - samples[i].x) +
+                      PATH_SMOOTH_SMOOTH * (samples[i - 1].x + samples[i + 1].x - 2 * samples[i].x);
+      samples[i].y += PATH_SMOOTH_DATA * (samples[i].curvature - samples[i].y) +
+                      PATH_SMOOTH_SMOOTH * (samples[i - 1].y + samples[i + 1].y - 2 * samples[i].y);
+      change += fabsf(samples[i].x - oldX) + fabsf(samples[i].y - oldY);
+    }
+  }
+  pathComputeGeometry(samples, n);
+  return n;
+}
+
+// ------------------- velocity limits -----------------------------------------------
+// In a curve the outside wheel goes faster than the robot center, and part of the wheel
+// acceleration goes into turning - so both limits shrink with the curvature.
+
+static float sampleAccel(const pathSample &sample, const trajConstraints &constraints) {
+  return constraints.maxAccel / (1 + fabsf(sample.curvature) * constraints.trackWidth / 2);
+}
+
+static float sampleMaxVel(const pathSample &sample, const trajConstraints &constraints) {
+  float wheelLimit = constraints.maxWheelVel / (1 + fabsf(sample.curvature) * constraints.trackWidth / 2);
+  return fminf(constraints.maxVel, wheelLimit);
+}
+
+// ------------------- generate trajectory -------------------------------------------
+int trajGenerate(pathSample* samples, int count, const trajConstraints &constraints,
+                 trajPoint* trajectory, int maxPoints) {
+  if(count < 2 || maxPoints < 1) {
+    return 0;
+  }
+
+  // 1. speed limit per sample and 2. forward pass - we start standing still
+  samples[0].velocity = 0;
+  for(int i = 1; i < count; i++) {
+    float ds = samples[i].s - samples[i - 1].s;
+    float reachable = sqrtf(samples[i - 1].velocity * samples[i - 1].velocity +
+                            2 * sampleAccel(samples[i - 1], constraints) * ds);
+    samples[i].velocity = fminf(sampleMaxVel(samples[i], constraints), reachable);
+  }
+
+  // 3. backward pass - we want to stop at the end
+  samples[count - 1].velocity = 0;
+  for(int i = count - 2; i >= 0; i--) {
+    float ds = samples[i + 1].s - samples[i].s;
+    float reachable = sqrtf(samples[i + 1].velocity * samples[i + 1].velocity +
+                            2 * sampleAccel(samples[i + 1], constraints) * ds);
+    samples[i].velocity = fminf(samples[i].velocity, reachable);
+  }
+
+  // time at which we pass each sample, with constant acceleration between two samples
+  samples[0].time = 0;
+  for(int i = 1; i < count; i++) {
+    float ds = samples[i].s - samples[i - 1].s;
+    float average = (samples[i].velocity + samples[i - 1].velocity) / 2;
+    samples[i].time = samples[i - 1].time + ((average > 0) ? ds / average : 0);
+  }
+
+  // walk along the samples in time steps - the sample index only ever moves forward
+  float dt = TRAJ_DT_MS / 1000.0;
+  int points = 0;
+  int i = 0;
+  for(float t = 0; points < maxPoints; t += dt) {
+    while(i < count - 2 && samples[i + 1].time <= t) {
+      i++;
+    }
+    const pathSample &a = samples[i];
+    const pathSample &b = samples[i + 1];
+    float segmentTime = b.time - a.time;
+    float f = (segmentTime > 0) ? (t - a.time) / segmentTime : 1;
+    f = fmaxf(0, fminf(1, f));
+    float turn = b.theta - a.theta;
+    while(turn > 3.14159) {
+      turn -= 2 * 3.14159;
+    }
+    while(turn < -3.14159) {
+      turn += 2 * 3.14159;
+    }
+
+    trajPoint &point = trajectory[points++];
+    point.x = a.x + (b.x - a.x) * f;
+    point.y = a.y + (b.y - a.y) * f;
+    point.theta = a.theta + turn * f;
+    point.v = a.velocity + (b.velocity - a.velocity) * f;
+    point.omega = point.v * (a.curvature + (b.curvature - a.curvature) * f);
+    point.a = (segmentTime > 0) ? (b.velocity - a.velocity) / segmentTime : 0;
+
+    if(t >= samples[count - 1].time) {
+      point.v = 0;                              // last point, standing still
+      point.omega = 0;
+      point.a = 0;
+      break;
+    }
+  }
+  return points;
+}
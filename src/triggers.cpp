@@ -0,0 +1,150 @@
+// ------- triggers.cpp ---------------------------------------------------------
+//
+// Use triggers.cpp together with triggers.hpp to run actions while the robot drives,
+// instead of only between two blocking moves.
+//
+// Distance and heading triggers are kept sorted, smallest first.  Distance and turned
+// angle only grow during a motion, so each control tick only has to look at the first
+// pending trigger of each list - once it fires the next one moves up.  Radius triggers
+// can not be sorted like that, they are checked in the order they were added.
+// Either way a tick costs the same small amount of work however many triggers wait.
+
+#include "main.h"
+#include "globals.hpp"
+#include "odometry.hpp"
+#include "triggers.hpp"
+
+struct trigger_t {
+  float value;                        // cm or degrees to fire at
+  float x;                            // radius triggers only - point and radius
+  float y;
+  triggerCallback callback;           // nullptr = post event instead
+  void* arg;
+  intakeEvent_e event;
+};
+
+// a list of pending triggers, already fired ones are before first
+struct triggerList_t {
+  trigger_t items[TRIGGER_MAX];
+  int first;
+  int count;
+};
+
+static triggerList_t distanceTriggers;
+static triggerList_t headingTriggers;
+static triggerList_t radiusTriggers;
+static float startTheta = 0;          // pose heading when the motion started
+
+// ------------------- add to a list -------------------------------------------------
+// sorted = insert in order of value, otherwise add at the end
+static void add(triggerList_t &list, const trigger_t &item, bool sorted) {
+  if(list.count >= TRIGGER_MAX) {
+    if(DEBUG) { std::cout << "Too many triggers \n";}
+    return;
+  }
+  int i = list.count;
+  while(sorted && i > list.first && list.items[i - 1].value > item.value) {
+    list.items[i] = list.items[i - 1];
+    i--;
+  }
+  list.items[i] = item;
+  list.count++;
+}
+
+static trigger_t makeTrigger(float value, triggerCallback callback, void* arg, intakeEvent_e event) {
+  trigger_t item = {};
+  item.value = value;
+  item.callback = callback;
+  item.arg = arg;
+  item.event = event;
+  return item;
+}
+
+void triggerAtDistance(float distance, triggerCallback callback, void* arg) {
+  add(distanceTriggers, makeTrigger(fabsf(distance), callback, arg, INTAKE_EV_STOP), true);
+}
+
+void triggerAtDistance(float distance, intakeEvent_e event) {
+  add(distanceTriggers, makeTrigger(fabsf(distance), nullptr, nullptr, event), true);
+}
+
+void triggerAtHeading(float degrees, triggerCallback callback, void* arg) {
+  add(headingTriggers, makeTrigger(fabsf(degrees), callback, arg, INTAKE_EV_STOP), true);
+}
+
+void triggerAtHeading(float degrees, intakeEvent_e event) {
+  add(headingTriggers, makeTrigger(fabsf(degrees), nullptr, nullptr, event), true);
+}
+
+void triggerInRadius(float x, float y, float radius, triggerCallback callback, void* arg) {
+  trigger_t item = makeTrigger(radius, callback, arg, INTAKE_EV_STOP);
+  item.x = x;
+  item.y = y;
+  add(radiusTriggers, item, false);
+}
+
+void triggerInRadius(float x, float y, float radius, intakeEvent_e event) {
+  trigger_t item = makeTrigger(radius, nullptr, nullptr, event);
+  item.x = x;
+  item.y = y;
+  add(radiusTriggers, item, false);
+}
+
+void triggersClear() {
+  distanceTriggers.first = distanceTriggers.count = 0;
+  headingTriggers.first = headingTriggers.count = 0;
+  radiusTriggers.first = radiusTriggers.count = 0;
+}
+
+// ------------------- fire ----------------------------------------------------------
+static void fire(const trigger_t &item) {
+  if(item.callback != nullptr) {
+    item.callback(item.arg);
+  } else {
+    intakePost(item.event);
+  }
+}
+
+// ------------------- motion start / tick / end -------------------------------------
+void triggersBegin() {
+  startTheta = getPose().theta;
+}
+
+void triggersCheck(float travelled) {
+  triggerList_t &distance = distanceTriggers;
+  while(distance.first < distance.count && fabsf(travelled) >= distance.items[distance.first].value) {
+    fire(distance.items[distance.first++]);
+  }
+
+  if(headingTriggers.first == headingTriggers.count &&
+     radiusTriggers.first == radiusTriggers.count) {
+    return;                           // no need to read the pose
+  }
+  pose_t pose = getPose();
+
+  triggerList_t &heading = headingTriggers;
+  float turned = fabsf(pose.theta - startTheta) * 180 / 3.14159;
+  while(heading.first < heading.count && turned >= heading.items[heading.first].value) {
+    fire(heading.items[heading.first++]);
+  }
+
+  triggerList_t &radius = radiusTriggers;
+  while(radius.first < radius.count) {
+    const trigger_t &item = radius.items[radius.first];
+    float dx = pose.x - item.x;
+    float dy = pose.y - item.y;
+    if(dx * dx + dy * dy > item.value * item.value) {
+      break;
+    }
+    fire(item);
+    radius.first++;
+  }
+}
+
+void triggersEnd() {
+  int missed = (distanceTriggers.count - distanceTriggers.first) +
+               (headingTriggers.count - headingTriggers.first) +
+               (radiusTriggers.count - radiusTriggers.first);
+  if(missed > 0 && DEBUG) { std::cout << missed << " triggers did not fire \n";}
+  triggersClear();
+}
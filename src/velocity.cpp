@@ -0,0 +1,164 @@
+// ------- velocity.cpp ---------------------------------------------------------
+//
+// Use velocity.cpp together with velocity.hpp to estimate the wheel velocity of the
+// odometer wheels.  The raw velocity from the rotation sensor, or from differencing two
+// position readings, is noisy - a VelocityEstimator runs one selectable filter on it.
+//
+// Every filter here only keeps a few numbers of state, so one sample costs the same
+// amount of work every time and nothing is allocated while running.  The only allocation
+// is the OkapiLib velMath helper, which is created once when that filter is selected.
+
+#include "main.h"
+#include "okapi/api.hpp"
+#include "globals.hpp"
+#include "traction.hpp"
+#include "velocity.hpp"
+
+// the two odometer estimators, updated by velocityTaskFnc()
+VelocityEstimator leftOdomVelocity(left_odom, ODOM_WHEEL_DIAM);
+VelocityEstimator rightOdomVelocity(right_odom, ODOM_WHEEL_DIAM);
+
+VelocityEstimator::VelocityEstimator(pros::Rotation &sensor, float wheelDiam,
+                                     velFilter_e filter, velSource_e source)
+  : sensor(sensor), cmPerCentiDeg((3.14 * wheelDiam) / 36000), filter(filter), source(source) {
+}
+
+// defined here as only this file knows the full okapi::VelMath type
+VelocityEstimator::~VelocityEstimator() = default;
+
+// ------------------- select filter -----------------------------------------------
+void VelocityEstimator::setFilter(velFilter_e newFilter, velSource_e newSource) {
+  filter = newFilter;
+  source = newSource;
+  if(filter == VEL_FILTER_OKAPI && !velMath) {
+    // rotation sensor counts 36000 centidegrees per revolution
+    velMath = okapi::VelMathFactory::createPtr(36000, VELOCITY_SAMPLE_MS * okapi::millisecond);
+  }
+  reset();
+}
+
+// ------------------- reset -------------------------------------------------------
+void VelocityEstimator::reset() {
+  started = false;
+  velocity = 0;
+  ema1 = 0;
+  ema2 = 0;
+  trackVel = 0;
+  for(int i = 0; i < VEL_MEDIAN_SIZE; i++) {
+    window[i] = 0;
+  }
+  windowIndex = 0;
+}
+
+// ------------------- raw velocity ------------------------------------------------
+// velocity in centidegrees/s from the selected source
+float VelocityEstimator::rawVelocity(std::int32_t position, std::int32_t sensorVel, float dt) {
+  if(source == VEL_SOURCE_SENSOR && sensorVel != PROS_ERR) {
+    return sensorVel;
+  }
+  return (position - lastPosition) / dt;
+}
+
+// ------------------- step --------------------------------------------------------
+// Read the sensor once and run the selected filter, returns velocity in cm/s
+float VelocityEstimator::step() {
+  std::int32_t position = sensor.get_position();
+  std::int32_t sensorVel = sensor.get_velocity();
+  std::uint32_t now = pros::millis();
+
+  if(position == PROS_ERR) {
+    return getVelocity();                 // sensor unplugged, keep last value
+  }
+  if(!started) {
+    // first sample - nothing to difference against yet
+    lastPosition = position;
+    lastTime = now;
+    trackPos = position;
+    started = true;
+    return getVelocity();
+  }
+
+  float dt = (now - lastTime) / 1000.0;
+  if(dt <= 0) {
+    dt = VELOCITY_SAMPLE_MS / 1000.0;
+  }
+
+  switch(filter) {
+    case VEL_FILTER_OKAPI:
+      // velMath returns rpm, convert to centidegrees/s
+      if(velMath) {
+        velocity = velMath->step(position).convert(okapi::rpm) * 36000 / 60;
+      }
+      break;
+
+    case VEL_FILTER_EMA:
+      ema1 += VEL_EMA_ALPHA * (rawVelocity(position, sensorVel, dt) - ema1);
+      velocity = ema1;
+      break;
+
+    case VEL_FILTER_DEMA:
+      // DEMA = 2 * EMA - EMA(EMA), removes most of the lag of a single EMA
+      ema1 += VEL_EMA_ALPHA * (rawVelocity(position, sensorVel, dt) - ema1);
+      ema2 += VEL_EMA_ALPHA * (ema1 - ema2);
+      velocity = 2 * ema1 - ema2;
+      break;
+
+    case VEL_FILTER_MEDIAN: {
+      window[windowIndex] = rawVelocity(position, sensorVel, dt);
+      windowIndex = (windowIndex + 1) % VEL_MEDIAN_SIZE;
+      // insertion sort of a fixed size copy - always the same amount of work
+      float sorted[VEL_MEDIAN_SIZE];
+      for(int i = 0; i < VEL_MEDIAN_SIZE; i++) {
+        float value = window[i];
+        int j = i;
+        while(j > 0 && sorted[j - 1] > value) {
+          sorted[j] = sorted[j - 1];
+          j--;
+        }
+        sorted[j] = value;
+      }
+      velocity = sorted[VEL_MEDIAN_SIZE / 2];
+      break;
+    }
+
+    case VEL_FILTER_TRACKING: {
+      // tracking loop: predict the position with the estimated velocity, the error
+      // against the measured position corrects both position and velocity.
+      trackPos += trackVel * dt;
+      float error = position - trackPos;
+      trackPos += VEL_TRACK_KP * error * dt;
+      trackVel += VEL_TRACK_KI * error * dt;
+      velocity = trackVel;
+      break;
+    }
+
+    case VEL_FILTER_NONE:
+    default:
+      velocity = rawVelocity(position, sensorVel, dt);
+      break;
+  }
+
+  lastPosition = position;
+  lastTime = now;
+  return getVelocity();
+}
+
+float VelocityEstimator::getVelocity() {
+  return velocity * cmPerCentiDeg;
+}
+
+// ----------------------- velocity estimator task ---------------------------------------
+// Keeps both odometer velocities up to date at the rotation sensor rate, started in
+// initialize() and never killed - other tasks only read the estimates.
+
+void velocityTaskFnc(void* ignore) {
+    //the void* is there to provide a way to pass a
+    //generic value or structure to the task if needed
+    //pros needs this parameter in your function even if you don't use it
+    std::uint32_t now = pros::millis();   // time stamp in milli sec
+    while(true) {
+      leftOdomVelocity.step();
+      rightOdomVelocity.step();
+      pros::Task::delay_until(&now, VELOCITY_SAMPLE_MS);
+    }
+}
@@ -0,0 +1,249 @@
+// ------- autoc.cpp ---------------------------------------------------------
+//
+// Host side tool - this is NOT compiled into the robot program, it runs on your computer.
+// Build and run it with "make autos" (see Makefile).
+//
+// Compiles an autonomous routine written in a small text language into the bytecode of
+// autoscript.hpp.  Copy the .bin file to the SD card and the robot runs it without
+// uploading a new program.  One instruction per line, # starts a comment:
+//
+//   drive <cm> <rpm>                  drive straight, negative cm is backwards
+//   turn <degrees> <rpm>              pivot turn, positive is clockwise
+//   swing <left cm> <right cm> <rpm>  each side its own distance, e.g. a swing turn
+//   intake stop|start|outtake|hold    send an event to the intake
+//   wait <ms>
+//   trigger distance <cm> <intake>    during the next drive / turn: intake event
+//   trigger heading <degrees> <intake>    after that distance or turned angle
+//   label <name>                      a place to jump to
+//   branch <condition> <label>        jump if condition: always, full, empty, jammed,
+//                                     red, blue (our alliance color)
+//   goto <label>                      jump always
+//   end                               stop the script here
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "intake.hpp"
+#include "autoscript.hpp"
+
+struct sourceLine {
+  int number;
+  std::vector<std::string> words;
+};
+
+static bool fail(int line, const char* message, const std::string &word = "") {
+  fprintf(stderr, "autoc: line %d: %s %s\n", line, message, word.c_str());
+  return false;
+}
+
+// ------------------- names ---------------------------------------------------------
+static bool intakeEvent(const std::string &name, int &event) {
+  static const std::map<std::string, int> events = {
+    {"stop", INTAKE_EV_STOP}, {"start", INTAKE_EV_INTAKE},
+    {"outtake", INTAKE_EV_OUTTAKE}, {"hold", INTAKE_EV_HOLD}
+  };
+  auto found = events.find(name);
+  if(found == events.end()) {
+    return false;
+  }
+  event = found->second;
+  return true;
+}
+
+static bool conditionCode(const std::string &name, int &condition) {
+  static const std::map<std::string, int> conditions = {
+    {"always", SCRIPT_ALWAYS}, {"full", SCRIPT_INTAKE_FULL}, {"empty", SCRIPT_INTAKE_EMPTY},
+    {"jammed", SCRIPT_INTAKE_JAMMED}, {"red", SCRIPT_ALLIANCE_RED}, {"blue", SCRIPT_ALLIANCE_BLUE}
+  };
+  auto found = conditions.find(name);
+  if(found == conditions.end()) {
+    return false;
+  }
+  condition = found->second;
+  return true;
+}
+
+// ------------------- numbers -------------------------------------------------------
+static bool number(const std::string &word, float &value) {
+  char* end;
+  value = strtof(word.c_str(), &end);
+  return !word.empty() && *end == 0;
+}
+
+// value * scale as int16, e.g. cm * 10 = mm
+static bool int16(const sourceLine &line, int index, float scale, std::vector<std::uint8_t> &out) {
+  float value;
+  if(!number(line.words[index], value) || fabsf(value * scale) > 32767) {
+    return fail(line.number, "number out of range:", line.words[index]);
+  }
+  int n = (int)lroundf(value * scale);
+  out.push_back(n & 0xFF);
+  out.push_back((n >> 8) & 0xFF);
+  return true;
+}
+
+static bool uint8(const sourceLine &line, int index, std::vector<std::uint8_t> &out) {
+  float value;
+  if(!number(line.words[index], value) || value < 0 || value > 255) {
+    return fail(line.number, "number out of range:", line.words[index]);
+  }
+  out.push_back((std::uint8_t)value);
+  return true;
+}
+
+// ------------------- compile one line ------------------------------------------------
+// labels are only known after the first pass, so branches first get target 0 and are
+// filled in by the second pass
+static bool compileLine(const sourceLine &line, std::vector<std::uint8_t> &out,
+                        const std::map<std::string, int> &labels, bool final) {
+  const std::vector<std::string> &w = line.words;
+  const std::string &op = w[0];
+  int event;
+  if(op == "drive" || op == "turn") {
+    if(w.size() != 3) {
+      return fail(line.number, "expected", op + " <value> <rpm>");
+    }
+    out.push_back(op == "drive" ? SCRIPT_DRIVE : SCRIPT_TURN);
+    return int16(line, 1, 10, out) && uint8(line, 2, out);
+  } else if(op == "swing") {
+    if(w.size() != 4) {
+      return fail(line.number, "expected", "swing <left cm> <right cm> <rpm>");
+    }
+    out.push_back(SCRIPT_SWING);
+    return int16(line, 1, 10, out) && int16(line, 2, 10, out) && uint8(line, 3, out);
+  } else if(op == "intake") {
+    if(w.size() != 2 || !intakeEvent(w[1], event)) {
+      return fail(line.number, "expected intake stop|start|outtake|hold");
+    }
+    out.push_back(SCRIPT_INTAKE);
+    out.push_back(event);
+  } else if(op == "wait") {
+    float ms;
+    if(w.size() != 2 || !number(w[1], ms) || ms < 0 || ms > 65535) {
+      return fail(line.number, "expected wait <ms> (0-65535)");
+    }
+    out.push_back(SCRIPT_WAIT);
+    out.push_back((int)ms & 0xFF);
+    out.push_back(((int)ms >> 8) & 0xFF);
+  } else if(op == "trigger") {
+    if(w.size() != 4 || (w[1] != "distance" && w[1] != "heading") || !intakeEvent(w[3], event)) {
+      return fail(line.number, "expected trigger distance|heading <value> <intake event>");
+    }
+    out.push_back(SCRIPT_TRIGGER);
+    out.push_back(w[1] == "distance" ? SCRIPT_TRIGGER_DISTANCE : SCRIPT_TRIGGER_HEADING);
+    if(!int16(line, 2, 10, out)) {
+      return false;
+    }
+    out.push_back(event);
+  } else if(op == "branch" || op == "goto") {
+    int condition = SCRIPT_ALWAYS;
+    std::string label;
+    if(op == "goto" && w.size() == 2) {
+      label = w[1];
+    } else if(op == "branch" && w.size() == 3 && conditionCode(w[1], condition)) {
+      label = w[2];
+    } else {
+      return fail(line.number, "expected branch <condition> <label> or goto <label>");
+    }
+    int target = 0;
+    if(final) {
+      auto found = labels.find(label);
+      if(found == labels.end()) {
+        return fail(line.number, "unknown label", label);
+      }
+      target = found->second;
+    }
+    out.push_back(SCRIPT_BRANCH);
+    out.push_back(condition);
+    out.push_back(target & 0xFF);
+    out.push_back((target >> 8) & 0xFF);
+  } else if(op == "end") {
+    out.push_back(SCRIPT_END);
+  } else {
+    return fail(line.number, "unknown instruction", op);
+  }
+  return true;
+}
+
+// ------------------- compile the file ------------------------------------------------
+static bool readSource(const char* fileName, std::vector<sourceLine> &lines) {
+  FILE* file = fopen(fileName, "r");
+  if(file == NULL) {
+    fprintf(stderr, "autoc: can not open %s\n", fileName);
+    return false;
+  }
+  char text[256];
+  int number = 0;
+  while(fgets(text, sizeof(text), file)) {
+    number++;
+    char* comment = strchr(text, '#');
+    if(comment) {
+      *comment = 0;
+    }
+    sourceLine line = {number, {}};
+    for(char* word = strtok(text, " \t\r\n"); word; word = strtok(NULL, " \t\r\n")) {
+      line.words.push_back(word);
+    }
+    if(!line.words.empty()) {
+      lines.push_back(line);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if(argc != 3) {
+    fprintf(stderr, "usage: autoc <routine.txt> <routine.bin>\n");
+    return 1;
+  }
+  std::vector<sourceLine> lines;
+  if(!readSource(argv[1], lines)) {
+    return 1;
+  }
+
+  // two passes: the first finds where every label is, the second writes the branches
+  std::map<std::string, int> labels;
+  std::vector<std::uint8_t> code;
+  for(int pass = 0; pass < 2; pass++) {
+    code.clear();
+    for(const sourceLine &line : lines) {
+      if(line.words[0] == "label") {
+        if(line.words.size() != 2) {
+          fail(line.number, "expected label <name>");
+          return 1;
+        }
+        if(pass == 0 && labels.count(line.words[1])) {
+          fail(line.number, "label used twice:", line.words[1]);
+          return 1;
+        }
+        labels[line.words[1]] = code.size();
+        continue;
+      }
+      if(!compileLine(line, code, labels, pass == 1)) {
+        return 1;
+      }
+    }
+  }
+  code.push_back(SCRIPT_END);             // a label at the very end needs something to land on
+
+  if(code.size() > SCRIPT_MAX_BYTES || !scriptValidate(code.data(), code.size())) {
+    fprintf(stderr, "autoc: %s is too long or not valid\n", argv[1]);
+    return 1;
+  }
+
+  FILE* out = fopen(argv[2], "wb");
+  if(out == NULL) {
+    fprintf(stderr, "autoc: can not write %s\n", argv[2]);
+    return 1;
+  }
+  scriptHeader header = {SCRIPT_MAGIC, SCRIPT_VERSION, (std::uint16_t)code.size()};
+  fwrite(&header, sizeof(header), 1, out);
+  fwrite(code.data(), 1, code.size(), out);
+  fclose(out);
+  printf("autoc: %s %d bytes\n", argv[2], (int)code.size());
+  return 0;
+}
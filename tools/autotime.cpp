@@ -0,0 +1,201 @@
+// ------- autotime.cpp ---------------------------------------------------------
+//
+// Host side tool - this is NOT compiled into the robot program, it runs on your computer.
+// Build and run it with "make autotime" (see Makefile).
+//
+// Tells how long a compiled autonomous script (tools/bin/<name>.bin, see autoc.cpp) takes
+// and if it fits in its time: AUTOTIME_SKILL_SEC (2 minutes, see autoSkill()) for a
+// skills routine (a name with "Skill" in it), AUTOTIME_MATCH_SEC for any other one.  A
+// different time in seconds can be given after the file:
+//
+//   autotime tools/bin/auto45sec.bin [seconds]
+//
+// Nothing is simulated, the time of every drive, turn and swing comes from the motion
+// profile the robot plans for it (src/drivemodel.cpp) - a wait takes its time and
+// intake and trigger instructions take none.  The script is not run, so we do not know
+// which way a branch goes: every way through the script is timed and the slowest one is
+// shown, with the time left over ("slack") after each instruction.  A loop is timed
+// once.  The "timeout" column is the time if every move runs into the DriveMove timeout.
+//
+// Only scripts are timed.  The C++ routines in src/autonomous.cpp, which run when there
+// is no script on the card, are not - their copies in tools/autos/ have to be kept in
+// step with them by hand.
+//
+// Returns 1 if the slowest way through the script does not fit.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "autoscript.hpp"
+#include "drivemodel.hpp"
+
+#define AUTOTIME_MAX_WAYS 100000      // stop looking after this many ways through
+#define AUTOTIME_SKILL_SEC 120        // skills run, the full 2 minutes
+#define AUTOTIME_MATCH_SEC 45         // autonomous period of a match
+
+struct segment {
+  int pc;               // offset of the instruction
+  float expected;       // seconds
+  float timeout;        // seconds
+};
+
+static std::uint8_t code[SCRIPT_MAX_BYTES];
+static int codeLength = 0;
+
+static std::vector<segment> way;        // the way through the script being timed
+static std::vector<segment> slowest;    // the slowest way found so far
+static float slowestTime = -1;
+static bool onWay[SCRIPT_MAX_BYTES];    // instruction is already on the current way
+static int ways = 0;
+static bool loops = false;
+
+// ------------------- read the script -----------------------------------------------
+static bool readScript(const char* fileName) {
+  FILE* file = fopen(fileName, "rb");
+  if(file == NULL) {
+    fprintf(stderr, "autotime: can not open %s\n", fileName);
+    return false;
+  }
+  scriptHeader header;
+  bool ok = fread(&header, sizeof(header), 1, file) == 1 && header.magic == SCRIPT_MAGIC &&
+            header.version == SCRIPT_VERSION && header.length <= SCRIPT_MAX_BYTES &&
+            fread(code, 1, header.length, file) == header.length &&
+            scriptValidate(code, header.length);
+  fclose(file);
+  if(!ok) {
+    fprintf(stderr, "autotime: %s is not a valid script\n", fileName);
+    return false;
+  }
+  codeLength = header.length;
+  return true;
+}
+
+// ------------------- time of one instruction ---------------------------------------
+static moveTime instructionTime(const std::uint8_t* op) {
+  switch(op[0]) {
+    case SCRIPT_DRIVE:
+      return timeDrive(scriptInt16(&op[1]) / 10.0, op[3]);
+    case SCRIPT_TURN:
+      return timeTurn(scriptInt16(&op[1]) / 10.0, op[3]);
+    case SCRIPT_SWING:
+      return timeDriveSides(scriptInt16(&op[1]) / 10.0, scriptInt16(&op[3]) / 10.0, op[5]);
+    case SCRIPT_WAIT: {
+      float seconds = scriptUint16(&op[1]) / 1000.0;
+      return {seconds, seconds};
+    }
+    default:
+      return {0, 0};
+  }
+}
+
+static void describe(const std::uint8_t* op, char* text, int size) {
+  switch(op[0]) {
+    case SCRIPT_DRIVE:
+      snprintf(text, size, "drive %.1f cm %d rpm", scriptInt16(&op[1]) / 10.0, op[3]);
+      break;
+    case SCRIPT_TURN:
+      snprintf(text, size, "turn %.1f deg %d rpm", scriptInt16(&op[1]) / 10.0, op[3]);
+      break;
+    case SCRIPT_SWING:
+      snprintf(text, size, "swing %.1f / %.1f cm %d rpm", scriptInt16(&op[1]) / 10.0,
+               scriptInt16(&op[3]) / 10.0, op[5]);
+      break;
+    case SCRIPT_WAIT:
+      snprintf(text, size, "wait %d ms", scriptUint16(&op[1]));
+      break;
+    default:
+      snprintf(text, size, "?");
+      break;
+  }
+}
+
+// ------------------- walk every way through the script -----------------------------
+// Depth first: at a branch which depends on the robot both the jump and the next
+// instruction are followed.  A jump back to an instruction which is already on the
+// way is a loop - that way ends there.
+
+static void walk(int pc, float time) {
+  if(ways >= AUTOTIME_MAX_WAYS) {
+    return;
+  }
+  std::size_t start = way.size();
+  std::vector<int> visited;
+  while(pc < codeLength && code[pc] != SCRIPT_END) {
+    if(onWay[pc]) {
+      loops = true;
+      break;
+    }
+    onWay[pc] = true;
+    visited.push_back(pc);
+    const std::uint8_t* op = &code[pc];
+    int next = pc + scriptOpSize(op[0]);
+
+    if(op[0] == SCRIPT_BRANCH) {
+      int target = scriptUint16(&op[2]);
+      if(op[1] != SCRIPT_ALWAYS) {
+        walk(target, time);               // jump taken, below it is not
+      } else {
+        next = target;
+      }
+    } else if(op[0] == SCRIPT_DRIVE || op[0] == SCRIPT_TURN || op[0] == SCRIPT_SWING ||
+              op[0] == SCRIPT_WAIT) {
+      moveTime t = instructionTime(op);
+      way.push_back({pc, t.expected, t.timeout});
+      time += t.expected;
+    }
+    pc = next;
+  }
+
+  ways++;
+  if(time > slowestTime) {
+    slowestTime = time;
+    slowest = way;
+  }
+  for(int visit : visited) {
+    onWay[visit] = false;
+  }
+  way.resize(start);
+}
+
+int main(int argc, char** argv) {
+  if(argc != 2 && argc != 3) {
+    fprintf(stderr, "usage: autotime <routine.bin> [seconds]\n");
+    return 1;
+  }
+  if(!readScript(argv[1])) {
+    return 1;
+  }
+  float budget = strstr(argv[1], "Skill") ? AUTOTIME_SKILL_SEC : AUTOTIME_MATCH_SEC;
+  if(argc == 3) {
+    budget = atof(argv[2]);
+  }
+
+  walk(0, 0);
+
+  printf("%s - %d way%s through the script, the slowest:\n\n", argv[1], ways,
+         ways == 1 ? "" : "s");
+  printf("  offset  instruction                     time s  end s   slack s  timeout s\n");
+  float end = 0;
+  float timeoutEnd = 0;
+  for(const segment &s : slowest) {
+    char text[48];
+    describe(&code[s.pc], text, sizeof(text));
+    end += s.expected;
+    timeoutEnd += s.timeout;
+    printf("  %6d  %-30s  %6.2f  %6.2f  %7.2f  %9.2f\n", s.pc, text, s.expected, end,
+           budget - end, s.timeout);
+  }
+  printf("\n  total %.2f s of %.0f s, slack %.2f s - %s\n", end, budget, budget - end,
+         end <= budget ? "fits" : "DOES NOT FIT");
+  if(timeoutEnd > budget) {
+    printf("  when every move times out it takes %.2f s\n", timeoutEnd);
+  }
+  if(loops) {
+    printf("  the script loops - every loop is timed once\n");
+  }
+  if(ways >= AUTOTIME_MAX_WAYS) {
+    printf("  stopped after %d ways through the script\n", AUTOTIME_MAX_WAYS);
+  }
+  return end <= budget ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+// ------- pathgen.cpp ---------------------------------------------------------
+//
+// Host side tool - this is NOT compiled into the robot program, it runs on your computer.
+// Build and run it with "make paths" (see Makefile).
+//
+// Reads the paths from tools/paths.txt, turns each one into a trajectory with the same
+// code the brain uses (src/trajectory.cpp) and writes them as constant tables into
+// src/pathtables.cpp and include/pathtables.hpp.  The robot then does not have to
+// generate anything at startup, a trajectory is just an array in the program.
+//
+// A path is either a list of points or a list of poses:
+//  - points are joined by straight lines which are then smoothed (pathFromWaypoints() in
+//    trajectory.cpp), so the robot drives curves through the corners instead of stopping
+//  - poses are joined by quintic splines (spline.cpp), the path goes exactly through
+//    every pose and the robot faces the given heading there
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "trajectory.hpp"
+#include "spline.hpp"
+#include "drivemodel.hpp"             // WHEEL_BASE
+
+#define MAX_SAMPLES 4000          // path samples, PATH_SPACING cm apart
+#define MAX_TRAJ_POINTS 6000      // 60 seconds of trajectory
+
+struct pathDef {
+  std::string name;
+  trajConstraints constraints;
+  std::vector<pathSample> waypoints;
+  std::vector<splinePose> poses;
+};
+
+// ------------------- read paths.txt ------------------------------------------------
+static bool readPaths(const char* fileName, std::vector<pathDef> &paths) {
+  FILE* file = fopen(fileName, "r");
+  if(file == NULL) {
+    fprintf(stderr, "pathgen: can not open %s\n", fileName);
+    return false;
+  }
+  char line[256];
+  int lineNumber = 0;
+  pathDef* current = NULL;
+  while(fgets(line, sizeof(line), file)) {
+    lineNumber++;
+    char word[64];
+    if(sscanf(line, "%63s", word) != 1 || word[0] == '#') {
+      continue;                         // empty line or comment
+    }
+    if(strcmp(word, "path") == 0) {
+      char name[64];
+      pathDef path;
+      if(sscanf(line, "%*s %63s %f %f %f", name, &path.constraints.maxVel,
+                &path.constraints.maxAccel, &path.constraints.maxWheelVel) != 4) {
+        fprintf(stderr, "pathgen: line %d: expected path <name> <maxVel> <maxAccel> <maxWheelVel>\n", lineNumber);
+        fclose(file);
+        return false;
+      }
+      path.name = name;
+      path.constraints.trackWidth = WHEEL_BASE;
+      paths.push_back(path);
+      current = &paths.back();
+    } else if(strcmp(word, "point") == 0 && current != NULL) {
+      pathSample sample = {};
+      if(sscanf(line, "%*s %f %f", &sample.x, &sample.y) != 2) {
+        fprintf(stderr, "pathgen: line %d: expected point <x> <y>\n", lineNumber);
+        fclose(file);
+        return false;
+      }
+      current->waypoints.push_back(sample);
+    } else if(strcmp(word, "pose") == 0 && current != NULL) {
+      splinePose pose;
+      float heading;
+      if(sscanf(line, "%*s %f %f %f", &pose.x, &pose.y, &heading) != 3) {
+        fprintf(stderr, "pathgen: line %d: expected pose <x> <y> <heading>\n", lineNumber);
+        fclose(file);
+        return false;
+      }
+      pose.theta = heading * 3.14159265 / 180;
+      current->poses.push_back(pose);
+    } else if(strcmp(word, "end") == 0) {
+      current = NULL;
+    } else {
+      fprintf(stderr, "pathgen: line %d: unknown '%s'\n", lineNumber, word);
+      fclose(file);
+      return false;
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+// ------------------- write the tables ----------------------------------------------
+static std::string upperCase(const std::string &name) {
+  std::string result;
+  for(char c : name) {
+    if(c >= 'a' && c <= 'z') {
+      result += c - 'a' + 'A';
+    } else if(c >= 'A' && c <= 'Z' && !result.empty()) {
+      result += '_';
+      result += c;
+    } else {
+      result += c;
+    }
+  }
+  return result;
+}
+
+int main(int argc, char** argv) {
+  if(argc != 4) {
+    fprintf(stderr, "usage: pathgen <paths.txt> <pathtables.cpp> <pathtables.hpp>\n");
+    return 1;
+  }
+  std::vector<pathDef> paths;
+  if(!readPaths(argv[1], paths)) {
+    return 1;
+  }
+
+  FILE* source = fopen(argv[2], "w");
+  FILE* header = fopen(argv[3], "w");
+  if(source == NULL || header == NULL) {
+    fprintf(stderr, "pathgen: can not write output files\n");
+    return 1;
+  }
+
+  fprintf(header, "#ifndef PATH_TABLES_H_\n#define PATH_TABLES_H_\n\n");
+  fprintf(header, "// GENERATED by tools/pathgen.cpp from tools/paths.txt - do not edit, run \"make paths\"\n\n");
+  fprintf(header, "#include \"trajectory.hpp\"\n\n");
+
+  fprintf(source, "// GENERATED by tools/pathgen.cpp from tools/paths.txt - do not edit, run \"make paths\"\n\n");
+  fprintf(source, "#include \"pathtables.hpp\"\n");
+
+  static pathSample samples[MAX_SAMPLES];
+  static trajPoint trajectory[MAX_TRAJ_POINTS];
+  static splinePath spline;
+  for(pathDef &path : paths) {
+    int sampleCount = 0;
+    if(!path.poses.empty() && !path.waypoints.empty()) {
+      fprintf(stderr, "pathgen: path %s mixes points and poses\n", path.name.c_str());
+      return 1;
+    } else if(!path.poses.empty()) {
+      if(!splineCreate(spline, path.poses.data(), path.poses.size())) {
+        fprintf(stderr, "pathgen: path %s needs 2 to %d poses\n", path.name.c_str(), SPLINE_MAX_SEGMENTS + 1);
+        return 1;
+      }
+      sampleCount = splineSample(spline, samples, MAX_SAMPLES, PATH_SPACING);
+    } else if(path.waypoints.size() >= 2) {
+      sampleCount = pathFromWaypoints(path.waypoints.data(), path.waypoints.size(), samples, MAX_SAMPLES);
+    } else {
+      fprintf(stderr, "pathgen: path %s needs at least 2 points\n", path.name.c_str());
+      return 1;
+    }
+    int count = trajGenerate(samples, sampleCount, path.constraints, trajectory, MAX_TRAJ_POINTS);
+    std::string size = upperCase(path.name) + "_POINTS";
+
+    fprintf(header, "#define %s %d    // %.2f sec, %.1f cm\n", size.c_str(), count,
+            count * TRAJ_DT_MS / 1000.0, samples[sampleCount - 1].s);
+    fprintf(header, "extern const trajPoint %s[%s];\n\n", path.name.c_str(), size.c_str());
+
+    fprintf(source, "\n// %s - x, y, theta, v, omega, a\n", path.name.c_str());
+    fprintf(source, "constexpr trajPoint %s[%s] = {\n", path.name.c_str(), size.c_str());
+    for(int i = 0; i < count; i++) {
+      const trajPoint &p = trajectory[i];
+      fprintf(source, "  {%.2ff, %.2ff, %.4ff, %.2ff, %.4ff, %.2ff},\n", p.x, p.y, p.theta, p.v, p.omega, p.a);
+    }
+    fprintf(source, "};\n");
+    printf("pathgen: %s %d points, %.2f sec\n", path.name.c_str(), count, count * TRAJ_DT_MS / 1000.0);
+  }
+
+  fprintf(header, "#endif\n");
+  fclose(source);
+  fclose(header);
+  return 0;
+}
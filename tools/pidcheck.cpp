@@ -0,0 +1,60 @@
+// ------- pidcheck.cpp ---------------------------------------------------------
+//
+// Host side tool - this is NOT compiled into the robot program, it runs on your computer.
+// Build and run it with "make pidcheck" (see Makefile).
+//
+// Runs the same steps through PID<float> and PID<Fixed> (pid.hpp, fixed.hpp) and checks
+// both give the same output.  The cases are the ones where Q16.16 runs out of range: a
+// large error times a large kP, and the D term dividing a big jump by a 10ms dt.  The
+// Fixed output may be limited by saturation, but it must never have the other sign.
+//
+// Returns 1 if any case differs by more than PIDCHECK_TOLERANCE mV.
+
+#include <cstdio>
+#include <cmath>
+#include "fixed.hpp"
+#include "pid.hpp"
+
+#define PIDCHECK_TOLERANCE 50         // mV, Q16.16 rounding of gains and dt
+
+struct pidCase {
+  const char* name;
+  float kP, kI, kD;
+  float measurements[4];              // setpoint is 0, one step per measurement
+};
+
+static const pidCase cases[] = {
+  // name                     kP     kI    kD     measurements
+  {"small error",           20.0,   0.0,  0.0,  {  -10,   -10,   -10,   -10}},
+  {"large error, large kP", 40.0,   0.0,  0.0,  {-1000, -1000, -1000, -1000}},
+  {"large negative error",  40.0,   0.0,  0.0,  { 1000,  1000,  1000,  1000}},
+  {"D term, big jump",       0.0,   0.0,  1.2,  {    0, -1000, -2000, -3000}},
+  {"integral clamped",      16.0,   8.0,  0.9,  { -500,  -500,  -450,  -400}},
+  {"all terms, reversing",  12.0,   5.0,  1.2,  {-3000,     0,  3000,  3000}}
+};
+
+int main() {
+  const float dt = 0.01;
+  int failed = 0;
+  for(const pidCase &c : cases) {
+    PID<float> pidFloat(dt);
+    PID<Fixed> pidFixed((Fixed(dt)));
+    pidFloat.setGains({c.kP, c.kI, c.kD});
+    pidFixed.setGains({Fixed(c.kP), Fixed(c.kI), Fixed(c.kD)});
+    pidFloat.setIntegralLimit(2000);
+    pidFixed.setIntegralLimit(Fixed(2000));
+    pidFloat.reset(c.measurements[0]);
+    pidFixed.reset(Fixed(c.measurements[0]));
+
+    for(int i = 0; i < 4; i++) {
+      float outFloat = pidFloat.step(0, c.measurements[i]);
+      float outFixed = pidFixed.step(Fixed(0), Fixed(c.measurements[i])).toFloat();
+      bool ok = fabsf(outFloat - outFixed) <= PIDCHECK_TOLERANCE;
+      printf("  %-24s step %d  float %8.1f  fixed %8.1f  %s\n", c.name, i, outFloat, outFixed,
+             ok ? "ok" : "DIFFERENT");
+      failed += ok ? 0 : 1;
+    }
+  }
+  printf("\n  %s\n", failed == 0 ? "PID<Fixed> matches PID<float>" : "PID<Fixed> DOES NOT MATCH");
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,506 @@
+// ------- routeopt.cpp ---------------------------------------------------------
+//
+// Host side tool - this is NOT compiled into the robot program, it runs on your computer.
+// Build and run it with "make route" (see Makefile).
+//
+// Finds the fastest order to do the tasks of a skills routine, and writes it as an
+// autonomous script for autoc.cpp.  The tasks are listed in a text file, one per line,
+// # starts a comment:
+//
+//   start <x> <y> <heading>           where the robot starts
+//   speed <drive rpm> <turn rpm>      speeds for the drives and the turns
+//   task <name> <x> <y> [options]     a place the robot has to go to, options:
+//        dwell <ms>                   time spent at the task
+//        face <heading>               turn to this heading before the dwell
+//        intake stop|start|outtake|hold   intake event when the robot gets there
+//        approach forward|backward    drive to it this way, for example forward to
+//                                     pick something up with the intake - default any
+//        after <name>[,<name>...]     only after these tasks are done
+//
+// Positions are cm in field coordinates (see planner.hpp), headings are degrees like the
+// odometry: 0 along the x axis, counter clockwise is positive.
+//
+// Every way from one task to the next is planned once with the route planner
+// (planner.cpp) and timed with the drivebase model (drivemodel.cpp) - a pivot turn onto
+// every straight piece of the route and a drive along it.  The robot may drive to a task
+// forwards or backwards, which changes the turns before and after it.
+//
+// The search is simulated annealing: start from the order in the file, make a small
+// random change (swap two tasks, move one, reverse a part of the order, or drive to one
+// the other way around) and keep it when it is faster - and sometimes also when it is
+// slower, less and less often as the search goes on, so it does not get stuck in the
+// first order which can not be improved by one small change.  ROUTE_THREADS searches
+// run at the same time with different random numbers, the fastest order wins.  The
+// random numbers are seeded, so the same file always gives the same routine.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "drivemodel.hpp"
+#include "planner.hpp"
+
+#define ROUTE_THREADS 8               // searches running at the same time
+#define ROUTE_STEPS 200000            // changes tried by every search
+#define ROUTE_START_TEMP 2.0          // seconds - how much slower a change may be at first
+#define ROUTE_END_TEMP 0.005          // seconds - at the end of the search
+#define ROUTE_MIN_TURN 0.5            // degrees, smaller turns are left out
+#define ROUTE_MAX_TASKS 64
+
+struct routeTask {
+  std::string name;
+  float x;                            // cm, field coordinates
+  float y;
+  int dwell;                          // ms
+  float face;                         // degrees, NAN = any heading
+  std::string intake;                 // intake event on arrival, "" = none
+  int approach;                       // 1 forward, -1 backward, 0 any way
+  std::vector<std::string> afterNames;
+  std::vector<int> after;             // tasks which have to be done first
+};
+
+// the way from one task to another, planned once
+struct routeLeg {
+  bool reachable;
+  std::vector<pathSample> points;     // planner waypoints, start and goal included
+  float inner;                        // seconds: the drives and the turns in between
+  float first;                        // degrees, heading of the first piece - NAN if
+  float last;                         // the robot does not move, and of the last piece
+};
+
+// an order of the tasks, and for every task if it is driven to backwards
+struct routePlan {
+  std::vector<int> order;
+  std::vector<char> reverse;          // indexed by task
+};
+
+static std::vector<routeTask> tasks;
+static std::vector<routeLeg> legs;    // legs[from * count + to], from = count is the start
+static float startX = 0;
+static float startY = 0;
+static float startHeading = 0;
+static int driveSpeed = 50;
+static int turnSpeed = 25;
+
+static bool fail(int line, const char* message, const std::string &word = "") {
+  fprintf(stderr, "routeopt: line %d: %s %s\n", line, message, word.c_str());
+  return false;
+}
+
+// ------------------- read the tasks ------------------------------------------------
+static bool number(const char* word, float &value) {
+  char* end;
+  if(word == NULL) {
+    return false;
+  }
+  value = strtof(word, &end);
+  return *word != 0 && *end == 0;
+}
+
+static bool readTasks(const char* fileName) {
+  FILE* file = fopen(fileName, "r");
+  if(file == NULL) {
+    fprintf(stderr, "routeopt: can not open %s\n", fileName);
+    return false;
+  }
+  char text[256];
+  int line = 0;
+  bool ok = true;
+  while(ok && fgets(text, sizeof(text), file)) {
+    line++;
+    char* comment = strchr(text, '#');
+    if(comment) {
+      *comment = 0;
+    }
+    char* word = strtok(text, " \t\r\n");
+    if(word == NULL) {
+      continue;
+    }
+    float a = 0, b = 0, c = 0;
+    if(strcmp(word, "start") == 0) {
+      ok = (number(strtok(NULL, " \t\r\n"), a) && number(strtok(NULL, " \t\r\n"), b) &&
+            number(strtok(NULL, " \t\r\n"), c)) || fail(line, "expected start <x> <y> <heading>");
+      startX = a;
+      startY = b;
+      startHeading = c;
+    } else if(strcmp(word, "speed") == 0) {
+      ok = (number(strtok(NULL, " \t\r\n"), a) && number(strtok(NULL, " \t\r\n"), b) &&
+            a > 0 && a <= 255 && b > 0 && b <= 255) ||
+           fail(line, "expected speed <drive rpm> <turn rpm>");
+      driveSpeed = a;
+      turnSpeed = b;
+    } else if(strcmp(word, "task") == 0) {
+      routeTask task = {"", 0, 0, 0, NAN, "", 0, {}, {}};
+      char* name = strtok(NULL, " \t\r\n");
+      if(name == NULL || !number(strtok(NULL, " \t\r\n"), task.x) ||
+         !number(strtok(NULL, " \t\r\n"), task.y)) {
+        ok = fail(line, "expected task <name> <x> <y> [options]");
+        break;
+      }
+      task.name = name;
+      for(char* option = strtok(NULL, " \t\r\n"); ok && option; option = strtok(NULL, " \t\r\n")) {
+        char* value = strtok(NULL, " \t\r\n");
+        if(value == NULL) {
+          ok = fail(line, "no value for", option);
+        } else if(strcmp(option, "dwell") == 0) {
+          ok = (number(value, a) && a >= 0 && a <= 65535) || fail(line, "bad dwell", value);
+          task.dwell = a;
+        } else if(strcmp(option, "face") == 0) {
+          ok = number(value, task.face) || fail(line, "bad heading", value);
+        } else if(strcmp(option, "intake") == 0) {
+          task.intake = value;
+          ok = task.intake == "stop" || task.intake == "start" || task.intake == "outtake" ||
+               task.intake == "hold" || fail(line, "unknown intake event", value);
+        } else if(strcmp(option, "approach") == 0) {
+          task.approach = (strcmp(value, "forward") == 0) ? 1 : (strcmp(value, "backward") == 0) ? -1 : 0;
+          ok = task.approach != 0 || strcmp(value, "any") == 0 || fail(line, "bad approach", value);
+        } else if(strcmp(option, "after") == 0) {
+          std::string list = value;
+          for(std::size_t begin = 0, end; begin <= list.size(); begin = end + 1) {
+            end = list.find(',', begin);
+            end = (end == std::string::npos) ? list.size() : end;
+            task.afterNames.push_back(list.substr(begin, end - begin));
+          }
+        } else {
+          ok = fail(line, "unknown option", option);
+        }
+      }
+      tasks.push_back(task);
+      ok = ok && (tasks.size() <= ROUTE_MAX_TASKS || fail(line, "too many tasks"));
+    } else {
+      ok = fail(line, "unknown line", word);
+    }
+  }
+  fclose(file);
+  if(!ok) {
+    return false;
+  }
+  if(tasks.empty()) {
+    fprintf(stderr, "routeopt: no tasks in %s\n", fileName);
+    return false;
+  }
+
+  // names to task numbers
+  for(routeTask &task : tasks) {
+    for(const std::string &name : task.afterNames) {
+      auto found = std::find_if(tasks.begin(), tasks.end(),
+                                [&](const routeTask &t) { return t.name == name; });
+      if(found == tasks.end()) {
+        fprintf(stderr, "routeopt: task %s comes after unknown task %s\n",
+                task.name.c_str(), name.c_str());
+        return false;
+      }
+      task.after.push_back(found - tasks.begin());
+    }
+  }
+  return true;
+}
+
+// ------------------- headings and turns --------------------------------------------
+static float wrap(float degrees) {
+  while(degrees > 180) {
+    degrees -= 360;
+  }
+  while(degrees <= -180) {
+    degrees += 360;
+  }
+  return degrees;
+}
+
+static float turnTime(float degrees) {
+  return fabsf(degrees) < ROUTE_MIN_TURN ? 0 : timeTurn(degrees, turnSpeed).expected;
+}
+
+// ------------------- plan the legs -------------------------------------------------
+// The planner keeps its work in static buffers, so all legs are planned here before
+// the searches start - the searches only read the legs.
+
+static routeLeg planLeg(float fromX, float fromY, float toX, float toY) {
+  routeLeg leg = {false, {}, 0, NAN, NAN};
+  pathSample waypoints[PLAN_MAX_WAYPOINTS];
+  int count = planRoute(fromX, fromY, toX, toY, waypoints, PLAN_MAX_WAYPOINTS);
+  if(count == 0) {
+    return leg;
+  }
+  leg.reachable = true;
+  leg.points.assign(waypoints, waypoints + count);
+  for(int i = 1; i < count; i++) {
+    float dx = waypoints[i].x - waypoints[i - 1].x;
+    float dy = waypoints[i].y - waypoints[i - 1].y;
+    float length = hypotf(dx, dy);
+    if(length < 0.5) {
+      continue;
+    }
+    float heading = atan2f(dy, dx) * 180 / M_PI;
+    if(std::isnan(leg.first)) {
+      leg.first = heading;
+    } else {
+      leg.inner += turnTime(wrap(heading - leg.last));
+    }
+    leg.inner += timeDrive(length, driveSpeed).expected;
+    leg.last = heading;
+  }
+  return leg;
+}
+
+static bool planLegs() {
+  int count = tasks.size();
+  legs.resize((count + 1) * count);
+  for(int from = 0; from <= count; from++) {
+    float x = (from == count) ? startX : tasks[from].x;
+    float y = (from == count) ? startY : tasks[from].y;
+    for(int to = 0; to < count; to++) {
+      legs[from * count + to] = planLeg(x, y, tasks[to].x, tasks[to].y);
+    }
+  }
+  for(int to = 0; to < count; to++) {
+    if(planBlocked(tasks[to].x, tasks[to].y)) {
+      fprintf(stderr, "routeopt: the robot can not get to task %s\n", tasks[to].name.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+// ------------------- time of a plan ------------------------------------------------
+// Goes through the plan like the robot would.  With out set it also writes the script,
+// so the script is exactly what was timed.
+
+// the turns and drives of one leg, starting at the given heading
+static void writeLeg(FILE* out, const routeLeg &leg, bool reverse, float heading) {
+  float flip = reverse ? 180 : 0;
+  for(std::size_t i = 1; i < leg.points.size(); i++) {
+    float dx = leg.points[i].x - leg.points[i - 1].x;
+    float dy = leg.points[i].y - leg.points[i - 1].y;
+    float length = hypotf(dx, dy);
+    if(length < 0.5) {
+      continue;
+    }
+    float wanted = wrap(atan2f(dy, dx) * 180 / M_PI + flip);
+    float turn = wrap(wanted - heading);
+    if(fabsf(turn) >= ROUTE_MIN_TURN) {
+      fprintf(out, "turn %.1f %d\n", -turn, turnSpeed);       // positive is clockwise
+    }
+    fprintf(out, "drive %.1f %d\n", reverse ? -length : length, driveSpeed);
+    heading = wanted;
+  }
+}
+
+static float routeTime(const routePlan &plan, FILE* out) {
+  int count = tasks.size();
+  int at = count;
+  float heading = startHeading;
+  float time = 0;
+  for(int t : plan.order) {
+    const routeTask &task = tasks[t];
+    const routeLeg &leg = legs[at * count + t];
+    if(!leg.reachable) {
+      return INFINITY;
+    }
+    if(out) {
+      fprintf(out, "\n# %s%s\n", task.name.c_str(), plan.reverse[t] ? " - backwards" : "");
+    }
+    if(!std::isnan(leg.first)) {
+      float flip = plan.reverse[t] ? 180 : 0;
+      time += turnTime(wrap(leg.first + flip - heading)) + leg.inner;
+      if(out) {
+        writeLeg(out, leg, plan.reverse[t], heading);
+      }
+      heading = wrap(leg.last + flip);
+    }
+    if(!std::isnan(task.face)) {
+      float turn = wrap(task.face - heading);
+      time += turnTime(turn);
+      if(out && fabsf(turn) >= ROUTE_MIN_TURN) {
+        fprintf(out, "turn %.1f %d\n", -turn, turnSpeed);
+      }
+      heading = task.face;
+    }
+    if(out && !task.intake.empty()) {
+      fprintf(out, "intake %s\n", task.intake.c_str());
+    }
+    if(out && task.dwell > 0) {
+      fprintf(out, "wait %d\n", task.dwell);
+    }
+    time += task.dwell / 1000.0;
+    at = t;
+  }
+  return time;
+}
+
+// every task after the tasks it has to wait for
+static bool inOrder(const std::vector<int> &order) {
+  int position[ROUTE_MAX_TASKS];
+  for(std::size_t i = 0; i < order.size(); i++) {
+    position[order[i]] = i;
+  }
+  for(std::size_t t = 0; t < tasks.size(); t++) {
+    for(int after : tasks[t].after) {
+      if(position[after] > position[t]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// ------------------- the order in the file -----------------------------------------
+// The first task of the file which may go next, every time - the order as written,
+// as long as it keeps to the "after" rules.
+
+static bool fileOrder(routePlan &plan) {
+  int count = tasks.size();
+  std::vector<char> done(count, 0);
+  plan.order.clear();
+  plan.reverse.assign(count, 0);
+  for(int t = 0; t < count; t++) {
+    plan.reverse[t] = tasks[t].approach < 0;
+  }
+  while((int)plan.order.size() < count) {
+    int next = -1;
+    for(int t = 0; t < count && next < 0; t++) {
+      bool ready = !done[t];
+      for(int after : tasks[t].after) {
+        ready = ready && done[after];
+      }
+      if(ready) {
+        next = t;
+      }
+    }
+    if(next < 0) {
+      fprintf(stderr, "routeopt: the after rules go round in a circle\n");
+      return false;
+    }
+    done[next] = 1;
+    plan.order.push_back(next);
+  }
+  return true;
+}
+
+// ------------------- simulated annealing -------------------------------------------
+// One search, run by each thread.  It only reads the tasks and legs, so the searches
+// do not need to share anything while they run.
+
+struct routeResult {
+  routePlan plan;
+  float time;
+};
+
+static void anneal(unsigned seed, const routePlan &first, routeResult &result) {
+  std::mt19937 random(seed);
+  std::uniform_real_distribution<float> chance(0, 1);
+  int count = tasks.size();
+
+  routePlan current = first;
+  float currentTime = routeTime(current, NULL);
+  result.plan = current;
+  result.time = currentTime;
+
+  for(int step = 0; step < ROUTE_STEPS; step++) {
+    // cools down from ROUTE_START_TEMP to ROUTE_END_TEMP
+    float temp = ROUTE_START_TEMP * powf(ROUTE_END_TEMP / ROUTE_START_TEMP, (float)step / ROUTE_STEPS);
+    routePlan next = current;
+    int a = random() % count;
+    int b = random() % count;
+    switch(random() % 4) {
+      case 0:                                 // swap two tasks
+        std::swap(next.order[a], next.order[b]);
+        break;
+      case 1: {                               // move one task to another place
+        int task = next.order[a];
+        next.order.erase(next.order.begin() + a);
+        next.order.insert(next.order.begin() + b, task);
+        break;
+      }
+      case 2:                                 // reverse a part of the order
+        std::reverse(next.order.begin() + std::min(a, b), next.order.begin() + std::max(a, b) + 1);
+        break;
+      default:                                // drive to a task the other way around
+        if(tasks[next.order[a]].approach != 0) {
+          continue;
+        }
+        next.reverse[next.order[a]] = !next.reverse[next.order[a]];
+        break;
+    }
+    if(!inOrder(next.order)) {
+      continue;
+    }
+    float time = routeTime(next, NULL);
+    if(time < currentTime || chance(random) < expf((currentTime - time) / temp)) {
+      current = next;
+      currentTime = time;
+      if(time < result.time) {
+        result.plan = current;
+        result.time = time;
+      }
+    }
+  }
+}
+
+static void printOrder(const routePlan &plan) {
+  for(int t : plan.order) {
+    printf(" %s%s", tasks[t].name.c_str(), plan.reverse[t] ? "(back)" : "");
+  }
+  printf("\n");
+}
+
+int main(int argc, char** argv) {
+  if(argc != 3) {
+    fprintf(stderr, "usage: routeopt <tasks.txt> <routine.txt>\n");
+    return 1;
+  }
+  if(!readTasks(argv[1])) {
+    return 1;
+  }
+  planInit();
+  routePlan first;
+  if(!fileOrder(first) || !planLegs()) {
+    return 1;
+  }
+  float firstTime = routeTime(first, NULL);
+
+  std::vector<routeResult> results(ROUTE_THREADS);
+  std::vector<std::thread> threads;
+  for(int i = 0; i < ROUTE_THREADS; i++) {
+    threads.emplace_back(anneal, i + 1, std::cref(first), std::ref(results[i]));
+  }
+  for(std::thread &thread : threads) {
+    thread.join();
+  }
+  const routeResult* best = &results[0];
+  for(const routeResult &result : results) {
+    if(result.time < best->time) {
+      best = &result;
+    }
+  }
+  if(std::isinf(best->time)) {
+    fprintf(stderr, "routeopt: no order of the tasks can be driven\n");
+    return 1;
+  }
+
+  printf("order of the file %.2f s:", firstTime);
+  printOrder(first);
+  printf("fastest order     %.2f s:", best->time);
+  printOrder(best->plan);
+  if(!std::isinf(firstTime)) {
+    printf("%.2f s faster\n", firstTime - best->time);
+  }
+
+  FILE* out = fopen(argv[2], "w");
+  if(out == NULL) {
+    fprintf(stderr, "routeopt: can not write %s\n", argv[2]);
+    return 1;
+  }
+  fprintf(out, "# Made by tools/routeopt.cpp from %s - do not change this file, change the\n"
+               "# tasks and run \"make route\" again.  Takes %.2f s.\n", argv[1], best->time);
+  routeTime(best->plan, out);
+  fprintf(out, "end\n");
+  fclose(out);
+  printf("routeopt: %s written\n", argv[2]);
+  return 0;
+}